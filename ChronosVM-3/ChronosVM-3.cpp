@@ -1,45 +1,153 @@
-#include "stdafx.h"
-
-#include <iostream>
-
-#include <SDL.h>
-
-#include "SDL.h"
-#include "Timer.h"
-#include "SDLWindow.h"
-#include "InitError.h"
-#include "Texture.h"
-#include "Memory.h"
-#include "VirtualMachine.h"
-#include "Hardware.h"
-#include "Screen.h"
-#include "Storage.h"
-
-void func (uint64_t delta, uint64_t total) {
-
-}
-
-int main(int argc, char **argv) {
-	try {
-		srand (time (NULL));
-
-		VirtualMachine *VM = new VirtualMachine (0xFFFFF);
-		Screen *screen = new Screen (VM);
-		VM->AddHardware (screen);
-		VM->AddMemoryRegion (screen);
-		Storage *storage = new Storage (VM);
-		VM->AddHardware (storage);
-		VM->AddMemoryRegion (storage);
-
-		VM->Start (argv[1]);
-
-		getchar ();
-
-		return 0;
-	}
-	catch (const InitError &err) {
-		fprintf (stderr, "Error while initializing SDL: %s\n", err.what ());
-	}
-    return 1;
-}
-
+#include "stdafx.h"
+
+#include <iostream>
+
+#include <SDL.h>
+
+#include "SDL.h"
+#include "Timer.h"
+#include "SDLWindow.h"
+#include "InitError.h"
+#include "Texture.h"
+#include "Memory.h"
+#include "VirtualMachine.h"
+#include "Hardware.h"
+#include "Screen.h"
+#include "Framebuffer.h"
+#include "Storage.h"
+#include "DiskImage.h"
+#include "OverlayImage.h"
+#include "IntervalTimer.h"
+#include "Host.h"
+
+#include <vector>
+
+void func (uint64_t delta, uint64_t total) {
+
+}
+
+// A machine with the standard devices; a headless one hands its frames to
+// on_frame, or drops them without one. disk replaces data.img when set.
+// storage is handed back so the caller can tear it down before the disk's base.
+static VirtualMachine *CreateMachine (bool headless, Screen::frame_callback on_frame, Disk *disk, Storage *&storage) {
+	VirtualMachine *VM = new VirtualMachine (0xFFFFF);
+	Screen *screen = new Screen (VM);
+	if (headless)
+		screen->SetHeadless (on_frame);
+	VM->AddHardware (screen);
+	VM->AddMemoryRegion (screen);
+	Framebuffer *framebuffer = new Framebuffer (VM);
+	VM->AddHardware (framebuffer);
+	VM->AddMemoryRegion (framebuffer);
+	screen->SetFramebuffer (framebuffer);
+	storage = new Storage (VM);
+	if (disk != nullptr)
+		storage->SetDisk (disk);
+	VM->AddHardware (storage);
+	VM->AddMemoryRegion (storage);
+	IntervalTimer *pit = new IntervalTimer (VM);
+	VM->AddHardware (pit);
+	return VM;
+}
+
+// Runs count headless copies of the program on a Host until every one has
+// powered off, faulted or halted for good. Each writes to its own overlay,
+// vm<n>.ovl, over a shared read-only data.img; their frames are dropped.
+static int RunHosted (char *path, int count) {
+	DiskImage *base = new DiskImage ("data.img", Storage::image_size, true);
+	Host *host = new Host ();
+	std::vector<Storage *> storages;
+
+	for (int i = 0; i < count; i++) {
+		char overlay[32];
+		snprintf (overlay, sizeof (overlay), "vm%d.ovl", i);
+
+		Storage *storage;
+		VirtualMachine *VM = CreateMachine (true, nullptr, new OverlayImage (base, overlay), storage);
+		storages.push_back (storage);
+		VM->Start (path, VirtualMachine::Hosted);
+		host->Add (VM);
+	}
+
+	host->Wait ();
+	delete host;
+	for (Storage *storage : storages)
+		delete storage;
+	delete base;
+	return 0;
+}
+
+// ChronosVM-3 <program> [options]
+//
+//   --throttle        run at a fixed instruction rate instead of flat out
+//   --headless        no window; frames are dropped unless --frames is given
+//   --frames <path>   with --headless, append each changed 640x400 frame to
+//                     path as raw 32 bit ARGB pixels
+//   --overlay <path>  keep data.img untouched and write to an overlay instead
+//   --vms <n>         run n headless copies on a worker pool (see RunHosted)
+//
+// Runs until a key is pressed; with --vms, until every copy is done.
+int main(int argc, char **argv) {
+	try {
+		srand (time (NULL));
+
+		VirtualMachine::run_mode mode = VirtualMachine::FreeRunning;
+		bool headless = false;
+		const char *frames = nullptr;
+		const char *overlay = nullptr;
+		int machines = 0;
+		for (int i = 2; i < argc; i++) {
+			if (strcmp (argv[i], "--throttle") == 0)
+				mode = VirtualMachine::Throttled;
+			else if (strcmp (argv[i], "--headless") == 0)
+				headless = true;
+			else if (strcmp (argv[i], "--frames") == 0 && i + 1 < argc)
+				frames = argv[++i];
+			else if (strcmp (argv[i], "--overlay") == 0 && i + 1 < argc)
+				overlay = argv[++i];
+			else if (strcmp (argv[i], "--vms") == 0 && i + 1 < argc)
+				machines = atoi (argv[++i]);
+		}
+
+		if (machines > 0)
+			return RunHosted (argv[1], machines);
+
+		// data.img stays untouched; this machine's writes go to the overlay
+		DiskImage *base = nullptr;
+		if (overlay != nullptr)
+			base = new DiskImage ("data.img", Storage::image_size, true);
+
+		FILE *sink = nullptr;
+		Screen::frame_callback on_frame = nullptr;
+		if (headless && frames != nullptr) {
+			sink = fopen (frames, "wb");
+			if (sink == nullptr) {
+				fprintf (stderr, "Could not open %s\n", frames);
+				return 1;
+			}
+			on_frame = [sink] (const uint32_t *pixels, int width, int height, const std::vector<SDL_Rect> &changed) {
+				fwrite (pixels, sizeof (uint32_t), width * height, sink);
+			};
+		}
+
+		Storage *storage;
+		VirtualMachine *VM = CreateMachine (headless, on_frame, base != nullptr ? new OverlayImage (base, overlay) : nullptr, storage);
+		VM->Start (argv[1], mode);
+
+		getchar ();
+
+		// The overlay reads through the base, so the base goes after the storage
+		VM->Shutdown ();
+		delete storage;
+		delete base;
+		if (sink != nullptr)
+			fclose (sink);
+
+		return 0;
+	}
+	catch (const InitError &err) {
+		fprintf (stderr, "Error while initializing SDL: %s\n", err.what ());
+	}
+    return 1;
+}
+
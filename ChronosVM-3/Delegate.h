@@ -0,0 +1,33 @@
+#pragma once
+
+// A callback that is only an object pointer and a function pointer. Binding one
+// allocates nothing, and an unbound delegate does nothing and returns zero, so
+// callers can invoke it without checking whether anything is registered.
+template <typename Signature> class Delegate;
+
+template <typename R, typename... Args>
+class Delegate<R (Args...)> {
+public:
+	typedef R (*stub_t) (void *object, Args...);
+
+	Delegate () :
+		object (nullptr),
+		stub (&Delegate::Open) { }
+	Delegate (void *object, stub_t stub) :
+		object (object),
+		stub (stub) { }
+
+	template <class T, R (T::*Method) (Args...)>
+	static inline Delegate Bind (T *object) {
+		return Delegate (object, &Delegate::Call<T, Method>);
+	}
+
+	inline R operator () (Args... args) const { return this->stub (this->object, args...); }
+private:
+	template <class T, R (T::*Method) (Args...)>
+	static R Call (void *object, Args... args) { return (((T *) object)->*Method) (args...); }
+	static R Open (void *object, Args...) { return R (); }
+
+	void *object;
+	stub_t stub;
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stdint.h>
+
+// What Storage reads and writes: a run of 512 byte sectors exposed as host
+// memory. Implementations may keep the sectors in more than one place, so a
+// caller asks for a run and gets back however much of it is contiguous.
+class Disk {
+public:
+	virtual ~Disk () { }
+
+	// Host memory for sectors from lba on. sectors is how many are wanted and
+	// comes back as how many lie contiguously at the pointer, at least one.
+	// A write mapping is for storing into; nullptr if lba is past the end or
+	// the disk cannot be written. whole promises the caller stores every byte
+	// of the run it gets back, so a disk need not fill it with the old data.
+	virtual uint8_t *Map (uint64_t lba, uint64_t &sectors, bool write, bool whole) = 0;
+	// Makes stores to those sectors durable
+	virtual void Flush (uint64_t lba, uint64_t sectors) = 0;
+
+	virtual uint64_t GetSectors () const = 0;
+
+	static const uint32_t sector_size = 512;
+};
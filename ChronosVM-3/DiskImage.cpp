@@ -0,0 +1,145 @@
+#include "DiskImage.h"
+
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+uint8_t *DiskImage::Map (uint64_t lba, uint64_t &sectors, bool write, bool whole) {
+	if (lba >= this->GetSectors () || (write && this->read_only))
+		return nullptr;
+	if (sectors > this->GetSectors () - lba)
+		sectors = this->GetSectors () - lba;
+	if (sectors == 0)
+		sectors = 1;
+	return this->data + lba * sector_size;
+}
+
+void DiskImage::Flush (uint64_t lba, uint64_t sectors) {
+	this->FlushRange (lba * sector_size, sectors * sector_size);
+}
+
+void DiskImage::Flush () {
+	this->FlushRange (0, this->size);
+}
+
+#ifdef _WIN32
+DiskImage::DiskImage (const char *path, uint64_t minimum_size, bool read_only) :
+	read_only (read_only),
+	file (INVALID_HANDLE_VALUE),
+	mapping (NULL) {
+	if (read_only)
+		this->file = CreateFileA (path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	else
+		this->file = CreateFileA (path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+
+	LARGE_INTEGER length;
+	if (this->file != INVALID_HANDLE_VALUE && GetFileSizeEx (this->file, &length)) {
+		this->size = (uint64_t) length.QuadPart;
+		if (!read_only && this->size < minimum_size) {
+			// Let the growth below stay a hole instead of allocated zeroes
+			DWORD returned;
+			DeviceIoControl (this->file, FSCTL_SET_SPARSE, NULL, 0, NULL, 0, &returned, NULL);
+			this->size = minimum_size;
+		}
+
+		// Mapping past the end of the file grows it to the mapping size
+		if (this->size > 0)
+			this->mapping = CreateFileMappingA (this->file, NULL, read_only ? PAGE_READONLY : PAGE_READWRITE, (DWORD) (this->size >> 32), (DWORD) this->size, NULL);
+		if (this->mapping != NULL)
+			this->data = (uint8_t *) MapViewOfFile (this->mapping, read_only ? FILE_MAP_READ : FILE_MAP_ALL_ACCESS, 0, 0, (SIZE_T) this->size);
+	}
+
+	if (this->data != nullptr) {
+		this->mapped = true;
+		return;
+	}
+
+	if (this->mapping != NULL)
+		CloseHandle (this->mapping);
+	if (this->file != INVALID_HANDLE_VALUE)
+		CloseHandle (this->file);
+	this->mapping = NULL;
+	this->file = INVALID_HANDLE_VALUE;
+
+	this->size = minimum_size;
+	this->data = (uint8_t *) calloc ((size_t) this->size, 1);
+}
+
+DiskImage::~DiskImage () {
+	if (!this->mapped) {
+		free (this->data);
+		return;
+	}
+
+	this->Flush ();
+	UnmapViewOfFile (this->data);
+	CloseHandle (this->mapping);
+	CloseHandle (this->file);
+}
+
+void DiskImage::FlushRange (uint64_t offset, uint64_t length) {
+	if (!this->mapped || this->read_only || length == 0)
+		return;
+	FlushViewOfFile (this->data + offset, (SIZE_T) length);
+	FlushFileBuffers (this->file);
+}
+#else
+DiskImage::DiskImage (const char *path, uint64_t minimum_size, bool read_only) :
+	read_only (read_only) {
+	this->file = read_only ? open (path, O_RDONLY) : open (path, O_RDWR | O_CREAT, 0644);
+
+	struct stat info;
+	if (this->file >= 0 && fstat (this->file, &info) == 0) {
+		this->size = (uint64_t) info.st_size;
+		if (!read_only && this->size < minimum_size)
+			this->size = minimum_size;
+
+		// Growing the file leaves a hole; the zero pages cost no disk until written
+		if (this->size > 0 && ((uint64_t) info.st_size >= this->size || ftruncate (this->file, (off_t) this->size) == 0)) {
+			void *view = mmap (NULL, (size_t) this->size, read_only ? PROT_READ : PROT_READ | PROT_WRITE, MAP_SHARED, this->file, 0);
+			if (view != MAP_FAILED)
+				this->data = (uint8_t *) view;
+		}
+	}
+
+	if (this->data != nullptr) {
+		this->mapped = true;
+		return;
+	}
+
+	if (this->file >= 0)
+		close (this->file);
+	this->file = -1;
+
+	this->size = minimum_size;
+	this->data = (uint8_t *) calloc ((size_t) this->size, 1);
+}
+
+DiskImage::~DiskImage () {
+	if (!this->mapped) {
+		free (this->data);
+		return;
+	}
+
+	this->Flush ();
+	munmap (this->data, (size_t) this->size);
+	close (this->file);
+}
+
+void DiskImage::FlushRange (uint64_t offset, uint64_t length) {
+	if (!this->mapped || this->read_only || length == 0)
+		return;
+
+	// msync wants a page aligned start
+	static const uint64_t page = (uint64_t) sysconf (_SC_PAGESIZE);
+	uint64_t start = offset & ~(page - 1);
+	msync (this->data + start, (size_t) (offset + length - start), MS_SYNC);
+}
+#endif
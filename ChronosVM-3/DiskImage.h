@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Disk.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+// A disk image file mapped into the address space. Pages are read in when
+// first touched and only the pages that were written go back to the file,
+// so opening and flushing cost what the guest uses rather than the image
+// size. Files smaller than the minimum size are extended with zeroes; larger
+// ones are mapped whole.
+//
+// If the file cannot be opened or mapped the image is zeroed memory that is
+// never saved, as it was before the file existed.
+//
+// A read-only image maps an existing file as it is, without extending it,
+// and can be shared by any number of OverlayImages.
+class DiskImage : public Disk {
+public:
+	DiskImage (const char *path, uint64_t minimum_size, bool read_only = false);
+	~DiskImage ();
+
+	uint8_t *Map (uint64_t lba, uint64_t &sectors, bool write, bool whole);
+	void Flush (uint64_t lba, uint64_t sectors);
+	inline uint64_t GetSectors () const { return this->size / sector_size; }
+
+	// Writes modified pages back to the file, waiting until they are on disk
+	void Flush ();
+	void FlushRange (uint64_t offset, uint64_t length);
+
+	inline uint8_t *GetData () const { return this->data; }
+	inline uint64_t GetSize () const { return this->size; }
+	inline bool IsMapped () const { return this->mapped; }
+private:
+	uint8_t *data = nullptr;
+	uint64_t size = 0;
+	bool mapped = false;
+	bool read_only;
+
+#ifdef _WIN32
+	void *file;
+	void *mapping;
+#else
+	int file = -1;
+#endif
+};
@@ -0,0 +1,164 @@
+#include "Framebuffer.h"
+
+#include <string.h>
+
+Framebuffer::Framebuffer (VirtualMachine *VM, uint32_t address) :
+	Hardware (VM),
+	MemoryRegion (address, width * height) {
+	this->pixels = new uint8_t[width * height];
+	memset (this->pixels, 0, width * height);
+	for (int i = 0; i < line_words; i++)
+		this->dirty[i] = 0;
+}
+
+Framebuffer::~Framebuffer () {
+	delete[] this->pixels;
+}
+
+void Framebuffer::Start () {
+	VirtualMachine *VM = Hardware::GetVM ();
+
+	VM->RequestPortInq<Framebuffer, &Framebuffer::SetSource> (0x50, this);
+	VM->RequestPortInq<Framebuffer, &Framebuffer::SetDestination> (0x51, this);
+	VM->RequestPortInq<Framebuffer, &Framebuffer::SetSize> (0x52, this);
+	VM->RequestPortInb<Framebuffer, &Framebuffer::SetColor> (0x53, this);
+	VM->RequestPortInb<Framebuffer, &Framebuffer::Command> (0x54, this);
+	VM->RequestPortInsb<Framebuffer, &Framebuffer::Write> (0x55, this);
+}
+
+void Framebuffer::SetSource (uint32_t value) {
+	this->source = value;
+}
+void Framebuffer::SetDestination (uint32_t value) {
+	this->destination = value;
+}
+void Framebuffer::SetSize (uint32_t value) {
+	this->size = value;
+}
+void Framebuffer::SetColor (uint8_t value) {
+	this->color = value;
+}
+
+void Framebuffer::Command (uint8_t value) {
+	int sx = this->source & 0xFFFF, sy = this->source >> 16;
+	int dx = this->destination & 0xFFFF, dy = this->destination >> 16;
+	int w = this->size & 0xFFFF, h = this->size >> 16;
+
+	// Clip against the destination, and for copies against the source too
+	if (dx >= width || dy >= height)
+		return;
+	if (w > width - dx)
+		w = width - dx;
+	if (h > height - dy)
+		h = height - dy;
+
+	if (value == Fill) {
+		for (int y = 0; y < h; y++)
+			memset (this->pixels + (dy + y) * width + dx, this->color, w);
+	} else if (value == Copy) {
+		if (sx >= width || sy >= height)
+			return;
+		if (w > width - sx)
+			w = width - sx;
+		if (h > height - sy)
+			h = height - sy;
+
+		// Walk rows bottom-up when the destination is below the source so
+		// overlapping rows are read before they are overwritten
+		for (int i = 0; i < h; i++) {
+			int y = dy > sy ? h - 1 - i : i;
+			memmove (this->pixels + (dy + y) * width + dx, this->pixels + (sy + y) * width + sx, w);
+		}
+	} else
+		return;
+
+	if (w > 0 && h > 0)
+		this->MarkLines (dy, dy + h - 1);
+}
+
+// Stores bytes linearly from the destination, wrapping onto following lines
+void Framebuffer::Write (const uint8_t *data, uint32_t count) {
+	uint32_t dx = this->destination & 0xFFFF, dy = this->destination >> 16;
+	if (dx >= width || dy >= height)
+		return;
+
+	uint32_t offset = dy * width + dx;
+	if (count > width * height - offset)
+		count = width * height - offset;
+	if (count == 0)
+		return;
+
+	memcpy (this->pixels + offset, data, count);
+	this->MarkLines (offset / width, (offset + count - 1) / width);
+
+	offset += count;
+	this->destination = offset < width * height ? ((offset / width) << 16) | (offset % width) : height << 16;
+}
+
+void Framebuffer::Clear (uint8_t value) {
+	memset (this->pixels, value, width * height);
+	this->MarkAllDirty ();
+}
+
+void Framebuffer::writew (uint32_t absolute, uint32_t relative, uint8_t data) {
+	this->pixels[relative] = data;
+	this->MarkLines (relative / width, relative / width);
+}
+void Framebuffer::writed (uint32_t absolute, uint32_t relative, uint16_t data) {
+	if (relative + 2 > width * height) {
+		this->writew (absolute, relative, data & 0xFF);
+		return;
+	}
+	memcpy (this->pixels + relative, &data, 2);
+	this->MarkLines (relative / width, (relative + 1) / width);
+}
+void Framebuffer::writeq (uint32_t absolute, uint32_t relative, uint32_t data) {
+	if (relative + 4 > width * height) {
+		for (uint32_t i = 0; relative + i < width * height; i++)
+			this->writew (absolute + i, relative + i, (data >> (i * 8)) & 0xFF);
+		return;
+	}
+	memcpy (this->pixels + relative, &data, 4);
+	this->MarkLines (relative / width, (relative + 3) / width);
+}
+
+uint8_t Framebuffer::readw (uint32_t absolute, uint32_t relative) {
+	return this->pixels[relative];
+}
+uint16_t Framebuffer::readd (uint32_t absolute, uint32_t relative) {
+	if (relative + 2 > width * height)
+		return this->pixels[relative];
+	uint16_t data;
+	memcpy (&data, this->pixels + relative, 2);
+	return data;
+}
+uint32_t Framebuffer::readq (uint32_t absolute, uint32_t relative) {
+	uint32_t data = 0;
+	if (relative + 4 > width * height) {
+		for (uint32_t i = 0; relative + i < width * height; i++)
+			data |= this->pixels[relative + i] << (i * 8);
+		return data;
+	}
+	memcpy (&data, this->pixels + relative, 4);
+	return data;
+}
+
+bool Framebuffer::TakeDirtyLines (uint64_t *lines) {
+	uint64_t any = 0;
+	for (int i = 0; i < line_words; i++)
+		any |= lines[i] = this->dirty[i].exchange (0, std::memory_order_acquire);
+	return any != 0;
+}
+
+void Framebuffer::MarkAllDirty () {
+	this->MarkLines (0, height - 1);
+}
+
+void Framebuffer::MarkLines (uint32_t first, uint32_t last) {
+	for (uint32_t word = first >> 6; word <= last >> 6; word++) {
+		uint32_t lo = word == first >> 6 ? first & 63 : 0;
+		uint32_t hi = word == last >> 6 ? last & 63 : 63;
+		uint64_t bits = (hi == 63 ? ~0ULL : (1ULL << (hi + 1)) - 1) & ~((1ULL << lo) - 1);
+		this->dirty[word].fetch_or (bits, std::memory_order_release);
+	}
+}
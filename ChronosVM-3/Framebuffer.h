@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Hardware.h"
+#include "MemoryRegion.h"
+
+#include <atomic>
+
+// A 640x400 linear framebuffer of 8 bit palette indices, one byte per pixel
+// row-major from address. Guest stores land in this shadow buffer and only
+// mark their scanline dirty; Screen converts dirty lines through its palette
+// once per frame while it is in graphics mode.
+//
+// Rectangles are moved without touching the buffer pixel by pixel:
+//
+//   inq  $50  source      (y << 16) | x     inb  $53  fill colour
+//   inq  $51  destination (y << 16) | x     inb  $54  command (see command)
+//   inq  $52  size        (h << 16) | w     insb $55  bytes to the destination onward
+//
+// Rectangles are clipped to the framebuffer; Copy handles overlap.
+class Framebuffer : public Hardware, public MemoryRegion {
+public:
+	enum command {
+		Fill	= 0x01,
+		Copy	= 0x02,
+	};
+
+	Framebuffer (VirtualMachine *VM, uint32_t address = 0x100000);
+	~Framebuffer ();
+
+	void Start ();
+
+	void SetSource (uint32_t value);
+	void SetDestination (uint32_t value);
+	void SetSize (uint32_t value);
+	void SetColor (uint8_t value);
+	void Command (uint8_t value);
+	void Write (const uint8_t *data, uint32_t count);
+	// Fills the whole framebuffer, leaving the guest's rectangle registers alone
+	void Clear (uint8_t value);
+
+	void writew (uint32_t absolute, uint32_t relative, uint8_t data);
+	void writed (uint32_t absolute, uint32_t relative, uint16_t data);
+	void writeq (uint32_t absolute, uint32_t relative, uint32_t data);
+
+	uint8_t readw (uint32_t absolute, uint32_t relative);
+	uint16_t readd (uint32_t absolute, uint32_t relative);
+	uint32_t readq (uint32_t absolute, uint32_t relative);
+
+	// Moves the set of lines changed since the last call into lines; false if none
+	bool TakeDirtyLines (uint64_t *lines);
+	void MarkAllDirty ();
+
+	inline const uint8_t *GetPixels () const { return this->pixels; }
+
+	static const int width = 640;
+	static const int height = 400;
+	static const int line_words = (height + 63) / 64;
+private:
+	void MarkLines (uint32_t first, uint32_t last);
+
+	uint32_t source = 0;
+	uint32_t destination = 0;
+	uint32_t size = 0;
+	uint8_t color = 0;
+
+	uint8_t *pixels;
+	std::atomic<uint64_t> dirty[line_words];
+};
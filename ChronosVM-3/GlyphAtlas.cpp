@@ -0,0 +1,122 @@
+#include "GlyphAtlas.h"
+
+#include <algorithm>
+
+// The atlas is a 16x16 grid of glyphs
+static const int atlas_columns = 16;
+
+GlyphAtlas::GlyphAtlas (SDL_Renderer *renderer, const uint8_t *font, int width, int height) :
+	queued ((width / glyph_width) * (height / glyph_height), -1),
+	columns (width / glyph_width),
+	renderer (renderer) {
+	const int atlas_width = atlas_columns * glyph_width;
+	const int atlas_height = (256 / atlas_columns) * glyph_height;
+	uint32_t *pixels = new uint32_t[atlas_width * atlas_height];
+
+	for (int glyph = 0; glyph < 256; glyph++) {
+		const uint8_t *lines = &font[glyph * glyph_height];
+		uint32_t *row = pixels + (glyph / atlas_columns) * glyph_height * atlas_width + (glyph % atlas_columns) * glyph_width;
+
+		this->blank[glyph] = true;
+		for (int y = 0; y < glyph_height; y++, row += atlas_width) {
+			if (lines[y] != 0)
+				this->blank[glyph] = false;
+			for (int x = 0; x < glyph_width; x++)
+				row[x] = lines[y] & (0x80 >> x) ? 0xFFFFFFFF : 0x00000000;
+		}
+	}
+
+	this->atlas = SDL_CreateTexture (this->renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, atlas_width, atlas_height);
+	SDL_UpdateTexture (this->atlas, NULL, pixels, atlas_width * sizeof (uint32_t));
+	SDL_SetTextureBlendMode (this->atlas, SDL_BLENDMODE_BLEND);
+	delete[] pixels;
+
+	this->target = SDL_CreateTexture (this->renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, width, height);
+	this->Clear (0xFFFFFFFF);
+}
+
+GlyphAtlas::~GlyphAtlas () {
+	SDL_DestroyTexture (this->atlas);
+	SDL_DestroyTexture (this->target);
+}
+
+bool GlyphAtlas::Supported (SDL_Renderer *renderer) {
+	return SDL_RenderTargetSupported (renderer) != 0;
+}
+
+void GlyphAtlas::Queue (int x, int y, uint8_t glyph, uint32_t fg, uint32_t bg) {
+	int &index = this->queued[y * this->columns + x];
+	if (index < 0) {
+		index = (int) this->cells.size ();
+		this->cells.push_back (cell ());
+	}
+
+	cell &c = this->cells[index];
+	c.dest = { x * glyph_width, y * glyph_height, glyph_width, glyph_height };
+	c.glyph = glyph;
+	c.fg = fg;
+	c.bg = bg;
+}
+
+void GlyphAtlas::Unqueue () {
+	for (const cell &c : this->cells)
+		this->queued[(c.dest.y / glyph_height) * this->columns + c.dest.x / glyph_width] = -1;
+}
+
+void GlyphAtlas::Clear (uint32_t color) {
+	this->Unqueue ();
+	this->cells.clear ();
+
+	SDL_SetRenderTarget (this->renderer, this->target);
+	SDL_SetRenderDrawColor (this->renderer, (color >> 16) & 0xFF, (color >> 8) & 0xFF, color & 0xFF, 0xFF);
+	SDL_RenderClear (this->renderer);
+	SDL_SetRenderTarget (this->renderer, NULL);
+}
+
+void GlyphAtlas::Flush () {
+	if (this->cells.empty ())
+		return;
+
+	SDL_SetRenderTarget (this->renderer, this->target);
+
+	// Queue keeps one entry per position, so the sorts below never have to
+	// order two draws of the same cell. The indices go stale once sorted.
+	this->Unqueue ();
+
+	// Backgrounds first, one SDL_RenderFillRects per colour
+	std::sort (this->cells.begin (), this->cells.end (), [] (const cell &a, const cell &b) { return a.bg < b.bg; });
+	for (size_t i = 0; i < this->cells.size (); ) {
+		uint32_t bg = this->cells[i].bg;
+		this->fills.clear ();
+		for (; i < this->cells.size () && this->cells[i].bg == bg; i++)
+			this->fills.push_back (this->cells[i].dest);
+
+		SDL_SetRenderDrawColor (this->renderer, (bg >> 16) & 0xFF, (bg >> 8) & 0xFF, bg & 0xFF, 0xFF);
+		SDL_RenderFillRects (this->renderer, this->fills.data (), (int) this->fills.size ());
+	}
+
+	// Then the glyphs, tinted from white and grouped so the colour mod only
+	// changes between runs
+	std::sort (this->cells.begin (), this->cells.end (), [] (const cell &a, const cell &b) { return a.fg < b.fg; });
+	bool tinted = false;
+	uint32_t fg = 0;
+	for (const cell &c : this->cells) {
+		if (this->blank[c.glyph])
+			continue;
+		if (!tinted || c.fg != fg) {
+			fg = c.fg;
+			tinted = true;
+			SDL_SetTextureColorMod (this->atlas, (fg >> 16) & 0xFF, (fg >> 8) & 0xFF, fg & 0xFF);
+		}
+
+		SDL_Rect src = { (c.glyph % atlas_columns) * glyph_width, (c.glyph / atlas_columns) * glyph_height, glyph_width, glyph_height };
+		SDL_RenderCopy (this->renderer, this->atlas, &src, &c.dest);
+	}
+
+	SDL_SetRenderTarget (this->renderer, NULL);
+	this->cells.clear ();
+}
+
+void GlyphAtlas::Draw (SDL_Rect *dest) {
+	SDL_RenderCopy (this->renderer, this->target, NULL, dest);
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <SDL.h>
+#include <stdint.h>
+#include <vector>
+
+// Draws text cells on the GPU. The font is uploaded once as a white-on-clear
+// texture, and cells are drawn into a render target that persists across
+// frames. Only the cells queued since the last Flush are redrawn.
+class GlyphAtlas {
+public:
+	GlyphAtlas (SDL_Renderer *renderer, const uint8_t *font, int width, int height);
+	~GlyphAtlas ();
+
+	// Render targets are optional in SDL; without them use Texture instead
+	static bool Supported (SDL_Renderer *renderer);
+
+	// A cell queued again before Flush replaces what was queued for it
+	void Queue (int x, int y, uint8_t glyph, uint32_t fg, uint32_t bg);
+	void Clear (uint32_t color);
+	// Draws every queued cell into the target
+	void Flush ();
+	void Draw (SDL_Rect *dest = NULL);
+
+	static const int glyph_width = 8;
+	static const int glyph_height = 16;
+private:
+	struct cell {
+		SDL_Rect dest;
+		uint8_t glyph;
+		uint32_t fg;
+		uint32_t bg;
+	};
+
+	// Forgets the positions of the queued cells, leaving cells as is
+	void Unqueue ();
+
+	std::vector<cell> cells;
+	// Index into cells for each queued position, -1 for the rest
+	std::vector<int> queued;
+	int columns;
+	std::vector<SDL_Rect> fills;
+	bool blank[256];
+
+	SDL_Texture *atlas;
+	SDL_Texture *target;
+	SDL_Renderer *renderer;
+};
@@ -1,7 +1,7 @@
-#include "Hardware.h"
-
-Hardware::Hardware (VirtualMachine *VM) :
-	VM (VM) { }
-
-
-Hardware::~Hardware () { }
+#include "Hardware.h"
+
+Hardware::Hardware (VirtualMachine *VM) :
+	VM (VM) { }
+
+
+Hardware::~Hardware () { }
@@ -0,0 +1,152 @@
+#include "Host.h"
+
+#include "VirtualMachine.h"
+
+Host::Host (unsigned int workers) :
+	running (true),
+	active (0),
+	next (0),
+	queued (0) {
+	if (workers == 0)
+		workers = 1;
+
+	for (unsigned int i = 0; i < workers; i++)
+		this->workers.push_back (new worker ());
+	for (size_t i = 0; i < this->workers.size (); i++)
+		this->workers[i]->thread = new std::thread (&Host::Work, this, i);
+}
+
+Host::~Host () {
+	this->Stop ();
+	for (worker *w : this->workers)
+		delete w;
+}
+
+void Host::Add (VirtualMachine *VM) {
+	this->active++;
+
+	// Called under the machine's wake_lock; only the wake that unparks it requeues it
+	VM->Wakeup = [this, VM] {
+		if (VM->parked.exchange (false))
+			this->Push (VM);
+	};
+	this->Push (VM);
+}
+
+void Host::Push (VirtualMachine *VM) {
+	worker *w = this->workers[this->next++ % this->workers.size ()];
+	{
+		std::lock_guard<std::mutex> guard (w->lock);
+		w->queue.push_back (VM);
+	}
+
+	std::lock_guard<std::mutex> guard (this->idle_lock);
+	this->queued++;
+	this->idle.notify_one ();
+}
+
+void Host::Wait () {
+	std::unique_lock<std::mutex> guard (this->idle_lock);
+	this->idle.wait (guard, [this] { return this->active == 0; });
+}
+
+void Host::Stop () {
+	if (!this->running.exchange (false))
+		return;
+
+	{
+		std::lock_guard<std::mutex> guard (this->idle_lock);
+		this->idle.notify_all ();
+	}
+	for (worker *w : this->workers) {
+		w->thread->join ();
+		delete w->thread;
+		w->thread = nullptr;
+	}
+}
+
+VirtualMachine *Host::Take (size_t index) {
+	{
+		worker *own = this->workers[index];
+		std::lock_guard<std::mutex> guard (own->lock);
+		if (!own->queue.empty ()) {
+			VirtualMachine *VM = own->queue.front ();
+			own->queue.pop_front ();
+			this->queued--;
+			return VM;
+		}
+	}
+
+	for (size_t i = 1; i < this->workers.size (); i++) {
+		worker *victim = this->workers[(index + i) % this->workers.size ()];
+		std::lock_guard<std::mutex> guard (victim->lock);
+		if (!victim->queue.empty ()) {
+			VirtualMachine *VM = victim->queue.back ();
+			victim->queue.pop_back ();
+			this->queued--;
+			return VM;
+		}
+	}
+
+	return nullptr;
+}
+
+bool Host::Finished (VirtualMachine *VM) {
+	if (VM->status == VirtualMachine::Off || VM->status & VirtualMachine::Fault)
+		return true;
+	// Nothing can deliver the interrupt that would end the halt
+	return VM->status & VirtualMachine::Halted && !VM->interrupts_enabled;
+}
+
+void Host::Retire (VirtualMachine *VM) {
+	VM->PowerOff ();
+	if (--this->active == 0) {
+		std::lock_guard<std::mutex> guard (this->idle_lock);
+		this->idle.notify_all ();
+	}
+}
+
+void Host::Work (size_t index) {
+	worker *own = this->workers[index];
+
+	while (this->running) {
+		VirtualMachine *VM = this->Take (index);
+		if (VM == nullptr) {
+			std::unique_lock<std::mutex> guard (this->idle_lock);
+			this->idle.wait (guard, [this] { return !this->running || this->queued > 0; });
+			continue;
+		}
+
+		VM->RunSlice (time_slice);
+
+		if (this->Finished (VM)) {
+			this->Retire (VM);
+			continue;
+		}
+
+		// Halted with nothing to deliver: off the queues until an interrupt
+		// or a status change wakes it. parked is published before looking,
+		// as in Park, so a Raise after the look sees it and requeues the
+		// machine; if something did arrive, whoever clears parked requeues it.
+		if (VM->status & VirtualMachine::Halted) {
+			VM->parked = true;
+			if (VM->status & VirtualMachine::Halted && !VM->InterruptReady ())
+				continue;
+			if (!VM->parked.exchange (false))
+				continue;
+		}
+
+		size_t queued;
+		{
+			std::lock_guard<std::mutex> guard (own->lock);
+			own->queue.push_back (VM);
+			queued = own->queue.size ();
+		}
+
+		std::lock_guard<std::mutex> guard (this->idle_lock);
+		this->queued++;
+		// Another worker only helps if there is more here than this one can run
+		if (queued > 1)
+			this->idle.notify_one ();
+	}
+}
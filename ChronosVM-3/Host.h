@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <condition_variable>
+
+class VirtualMachine;
+
+// Runs many VirtualMachines on a fixed pool of worker threads. Each worker
+// owns a queue of machines started with VirtualMachine::Hosted; a machine
+// runs for one time slice and then goes to the back of the queue. A worker
+// whose queue is empty steals from the back of another worker's queue, and
+// sleeps when there is nothing to steal.
+//
+// A machine halted waiting for an interrupt leaves the queues until its
+// Wake puts it back. One that powers off, faults, or halts with interrupts
+// disabled is powered off and dropped for good.
+class Host {
+public:
+	Host (unsigned int workers = std::thread::hardware_concurrency ());
+	~Host ();
+
+	void Add (VirtualMachine *VM);
+
+	// Blocks until every machine added so far has been powered off
+	void Wait ();
+	void Stop ();
+
+	// Instructions a machine runs before it yields its worker
+	static const int time_slice = 65536;
+private:
+	struct worker {
+		std::deque<VirtualMachine *> queue;
+		std::mutex lock;
+		std::thread *thread = nullptr;
+	};
+
+	void Work (size_t index);
+	VirtualMachine *Take (size_t index);
+	// Queues a runnable machine on a worker and wakes one idle worker
+	void Push (VirtualMachine *VM);
+	// True if VM can never run again
+	bool Finished (VirtualMachine *VM);
+	void Retire (VirtualMachine *VM);
+
+	std::vector<worker *> workers;
+	std::atomic<bool> running;
+	std::atomic<int> active;
+	std::atomic<size_t> next;
+	// Machines sitting in any worker's queue
+	std::atomic<int> queued;
+
+	std::mutex idle_lock;
+	std::condition_variable idle;
+};
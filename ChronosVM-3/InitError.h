@@ -1,16 +1,16 @@
-#pragma once
-
-#include <exception>
-#include <string>
-#include "SDL.h"
-
-class InitError : public std::exception {
-public:
-	InitError ();
-	InitError (const std::string&);
-	virtual ~InitError () throw ();
-	virtual const char *what () const throw ();
-private:
-	std::string msg;
-};
-
+#pragma once
+
+#include <exception>
+#include <string>
+#include "SDL.h"
+
+class InitError : public std::exception {
+public:
+	InitError ();
+	InitError (const std::string&);
+	virtual ~InitError () throw ();
+	virtual const char *what () const throw ();
+private:
+	std::string msg;
+};
+
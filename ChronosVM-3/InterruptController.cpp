@@ -0,0 +1,110 @@
+#include "InterruptController.h"
+
+#include "VirtualMachine.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+static inline int lowest_bit (uint64_t bits) {
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanForward64 (&index, bits);
+	return (int) index;
+#else
+	return __builtin_ctzll (bits);
+#endif
+}
+
+InterruptController::InterruptController (VirtualMachine *VM) :
+	VM (VM) {
+	for (int i = 0; i < 4; i++) {
+		this->pending[i] = 0;
+		this->mask[i] = 0;
+		this->in_service[i] = 0;
+	}
+
+	VM->RequestPortInb<InterruptController, &InterruptController::WriteEOI> (0x20, this);
+	VM->RequestPortInb<InterruptController, &InterruptController::SelectMask> (0x21, this);
+	VM->RequestPortInb<InterruptController, &InterruptController::WriteMask> (0x22, this);
+	VM->RequestPortInb<InterruptController, &InterruptController::SetThreshold> (0x23, this);
+	VM->RequestPortInb<InterruptController, &InterruptController::SetMode> (0x24, this);
+
+	VM->RequestPortOutb<InterruptController, &InterruptController::ReadInService> (0x20, this);
+	VM->RequestPortOutb<InterruptController, &InterruptController::ReadMask> (0x22, this);
+}
+
+InterruptController::~InterruptController () { }
+
+void InterruptController::Raise (uint8_t line) {
+	this->pending[line >> 6].fetch_or (1ULL << (line & 63));
+	if (this->VM->parked)
+		this->VM->Wake ();
+}
+
+int InterruptController::InService () const {
+	for (int i = 0; i < 4; i++)
+		if (this->in_service[i] != 0)
+			return i * 64 + lowest_bit (this->in_service[i]);
+	return 256;
+}
+
+int InterruptController::Next () const {
+	int limit = this->threshold == 0 ? 256 : this->threshold;
+	int serving = this->InService ();
+	if (serving < limit)
+		limit = serving;
+
+	for (int i = 0; i < 4 && i * 64 < limit; i++) {
+		uint64_t ready = this->pending[i].load (std::memory_order_acquire) & ~this->mask[i];
+		if (ready != 0) {
+			int line = i * 64 + lowest_bit (ready);
+			return line < limit ? line : -1;
+		}
+	}
+
+	return -1;
+}
+
+int InterruptController::Acknowledge () {
+	int line = this->Next ();
+	if (line < 0)
+		return -1;
+
+	uint64_t bit = 1ULL << (line & 63);
+	this->pending[line >> 6].fetch_and (~bit);
+	this->in_service[line >> 6] |= bit;
+	return line;
+}
+
+void InterruptController::EOI () {
+	int line = this->InService ();
+	if (line < 256)
+		this->in_service[line >> 6] &= ~(1ULL << (line & 63));
+}
+
+void InterruptController::WriteEOI (uint8_t value) {
+	this->EOI ();
+}
+void InterruptController::SelectMask (uint8_t value) {
+	this->selected = value & 31;
+}
+void InterruptController::WriteMask (uint8_t value) {
+	int shift = (this->selected & 7) * 8;
+	uint64_t &word = this->mask[this->selected >> 3];
+	word = (word & ~(0xFFULL << shift)) | ((uint64_t) value << shift);
+}
+void InterruptController::SetThreshold (uint8_t value) {
+	this->threshold = value;
+}
+void InterruptController::SetMode (uint8_t value) {
+	this->mode = value;
+}
+
+uint8_t InterruptController::ReadInService () {
+	int line = this->InService ();
+	return line < 256 ? (uint8_t) line : 0xFF;
+}
+uint8_t InterruptController::ReadMask () {
+	return (uint8_t) (this->mask[this->selected >> 3] >> ((this->selected & 7) * 8));
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+
+class VirtualMachine;
+
+// Latches interrupt requests for all 256 lines. Devices on any thread call
+// Raise, which only sets a bit in the lock-free pending mask; the VM thread
+// acknowledges the highest priority deliverable line between instructions.
+//
+// Lower line numbers have higher priority. A pending line is delivered when
+// it is unmasked, below the threshold (0 disables it) and of higher priority
+// than every line still in service. In auto-EOI mode (the default) iret ends
+// the service of the current line; otherwise the guest writes the EOI port.
+//
+//   inb  $20  EOI                      outb $20  line in service, $FF if none
+//   inb  $21  select mask byte 0-31    outb $22  read selected mask byte
+//   inb  $22  write selected mask byte
+//   inb  $23  priority threshold
+//   inb  $24  mode: bit 0 auto-EOI
+class InterruptController {
+public:
+	enum mode {
+		AutoEOI		= 0x01,
+	};
+
+	InterruptController (VirtualMachine *VM);
+	~InterruptController ();
+
+	void Raise (uint8_t line);
+
+	// Highest priority deliverable line, or -1; does not change any state
+	int Next () const;
+	// Claims Next () and marks it in service
+	int Acknowledge ();
+	void EOI ();
+
+	inline bool IsAutoEOI () const { return (this->mode & AutoEOI) != 0; }
+
+	void WriteEOI (uint8_t value);
+	void SelectMask (uint8_t value);
+	void WriteMask (uint8_t value);
+	void SetThreshold (uint8_t value);
+	void SetMode (uint8_t value);
+
+	uint8_t ReadInService ();
+	uint8_t ReadMask ();
+private:
+	int InService () const;
+
+	VirtualMachine *VM;
+
+	std::atomic<uint64_t> pending[4];
+	uint64_t mask[4];
+	uint64_t in_service[4];
+
+	uint8_t selected = 0;
+	uint8_t threshold = 0;
+	uint8_t mode = AutoEOI;
+};
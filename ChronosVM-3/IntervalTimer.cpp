@@ -0,0 +1,66 @@
+#include "IntervalTimer.h"
+
+IntervalTimer::IntervalTimer (VirtualMachine *VM, uint8_t line) :
+	Hardware (VM),
+	line (line) { }
+
+IntervalTimer::~IntervalTimer () {
+	this->Disarm ();
+}
+
+void IntervalTimer::Start () {
+	VirtualMachine *VM = Hardware::GetVM ();
+
+	VM->RequestPortInb<IntervalTimer, &IntervalTimer::SetReloadLow> (0x40, this);
+	VM->RequestPortInb<IntervalTimer, &IntervalTimer::SetReloadHigh> (0x41, this);
+	VM->RequestPortInb<IntervalTimer, &IntervalTimer::SetLine> (0x42, this);
+	VM->RequestPortInb<IntervalTimer, &IntervalTimer::Control> (0x43, this);
+
+	VM->RequestPortOutb<IntervalTimer, &IntervalTimer::Status> (0x43, this);
+}
+
+void IntervalTimer::Stop () {
+	this->Disarm ();
+}
+
+void IntervalTimer::SetReloadLow (uint8_t value) {
+	this->reload = (uint16_t) ((this->reload & 0xFF00) | value);
+}
+void IntervalTimer::SetReloadHigh (uint8_t value) {
+	this->reload = (uint16_t) ((this->reload & 0x00FF) | (value << 8));
+}
+void IntervalTimer::SetLine (uint8_t value) {
+	this->line = value;
+}
+
+void IntervalTimer::Control (uint8_t value) {
+	this->Disarm ();
+	if (value != Periodic && value != OneShot)
+		return;
+
+	uint16_t reload = this->reload;
+	uint64_t counts = reload == 0 ? 0x10000 : reload;
+	std::chrono::nanoseconds period ((long long) (counts * 1000000000ULL / base_clock));
+
+	this->mode = value;
+	this->timer = TimerWheel::Shared ().Schedule (period, TimerWheel::callback::Bind<IntervalTimer, &IntervalTimer::Fire> (this), value == Periodic);
+}
+
+uint8_t IntervalTimer::Status () {
+	uint8_t current = this->mode;
+	return (current != Disarmed ? 0x01 : 0x00) | (current == Periodic ? 0x02 : 0x00);
+}
+
+// Runs on the timer wheel thread
+void IntervalTimer::Fire () {
+	uint8_t expected = OneShot;
+	this->mode.compare_exchange_strong (expected, Disarmed);
+	Hardware::GetVM ()->interrupt (this->line);
+}
+
+void IntervalTimer::Disarm () {
+	if (this->timer != 0)
+		TimerWheel::Shared ().Cancel (this->timer);
+	this->timer = 0;
+	this->mode = Disarmed;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Hardware.h"
+#include "TimerWheel.h"
+
+#include <atomic>
+
+// A PIT-style programmable interval timer. The guest latches a 16 bit reload
+// value and an interrupt line, then arms it through the control port; the
+// line is raised every reload / base_clock seconds (or once, in one-shot mode).
+//
+//   inb  $40  reload low byte          inb  $42  interrupt line
+//   inb  $41  reload high byte         inb  $43  control (see mode)
+//   outb $43  status: bit 0 armed, bit 1 periodic
+//
+// A reload of zero counts as 65536. Expirations are driven by the shared
+// TimerWheel, so the device needs no thread of its own.
+class IntervalTimer : public Hardware {
+public:
+	enum mode {
+		Disarmed	= 0x00,
+		Periodic	= 0x01,
+		OneShot		= 0x02,
+	};
+
+	IntervalTimer (VirtualMachine *VM, uint8_t line = 32);
+	~IntervalTimer ();
+
+	void Start ();
+	void Stop ();
+
+	void SetReloadLow (uint8_t value);
+	void SetReloadHigh (uint8_t value);
+	void SetLine (uint8_t value);
+	void Control (uint8_t value);
+	uint8_t Status ();
+
+	void Fire ();
+
+	static const uint32_t base_clock = 1193182;
+private:
+	void Disarm ();
+
+	// Port writes land on the VM thread while Fire runs on the wheel thread
+	std::atomic<uint16_t> reload { 0 };
+	std::atomic<uint8_t> line;
+	std::atomic<uint8_t> mode { Disarmed };
+
+	TimerWheel::handle timer = 0;
+};
@@ -0,0 +1,400 @@
+#include "Jit.h"
+
+#include "VirtualMachine.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+// Host registers the ten full guest registers (A-F, W-Z) live in while a block runs
+static const int host_reg[10] = { 8, 9, 10, 11, 12, 13, 14, 15, 6, 7 };
+static const int saved_reg[] = { 3, 6, 7, 12, 13, 14, 15 };
+
+#define EAX 0
+#define ECX 1
+#define EDX 2
+#define RBX 3
+
+#define REG_OFFSET(slot) (offsetof (struct VirtualMachine::registers, A) + (slot) * sizeof (VirtualMachine::register_t))
+#define FLAGS_OFFSET offsetof (struct VirtualMachine::registers, Flags)
+#define PC_OFFSET offsetof (struct VirtualMachine::registers, PC)
+
+static inline void emit8 (uint8_t *&p, uint8_t val) { *p++ = val; }
+static inline void emit16 (uint8_t *&p, uint16_t val) { memcpy (p, &val, 2); p += 2; }
+static inline void emit32 (uint8_t *&p, uint32_t val) { memcpy (p, &val, 4); p += 4; }
+
+static inline void rex (uint8_t *&p, int reg, int rm) {
+	if (reg >= 8 || rm >= 8)
+		emit8 (p, 0x40 | ((reg >> 3) << 2) | (rm >> 3));
+}
+static inline void modrm (uint8_t *&p, int mod, int reg, int rm) {
+	emit8 (p, (mod << 6) | ((reg & 7) << 3) | (rm & 7));
+}
+
+// <op> dst, src for the 32 bit r/m, reg forms (mov 89, add 01, or 09, xor 31)
+static void alu_rr (uint8_t *&p, uint8_t opcode, int dst, int src) {
+	rex (p, src, dst);
+	emit8 (p, opcode);
+	modrm (p, 3, src, dst);
+}
+// 81 /ext dst, imm32 (add 0, or 1, and 4, sub 5, cmp 7)
+static void alu_ri (uint8_t *&p, int ext, int dst, uint32_t imm) {
+	rex (p, 0, dst);
+	emit8 (p, 0x81);
+	modrm (p, 3, ext, dst);
+	emit32 (p, imm);
+}
+static void mov_ri (uint8_t *&p, int dst, uint32_t imm) {
+	rex (p, 0, dst);
+	emit8 (p, 0xB8 + (dst & 7));
+	emit32 (p, imm);
+}
+static void load (uint8_t *&p, int dst, uint32_t offset) {
+	rex (p, dst, RBX);
+	emit8 (p, 0x8B);
+	modrm (p, 2, dst, RBX);
+	emit32 (p, offset);
+}
+static void store (uint8_t *&p, uint32_t offset, int src) {
+	rex (p, src, RBX);
+	emit8 (p, 0x89);
+	modrm (p, 2, src, RBX);
+	emit32 (p, offset);
+}
+
+static int slot (uint8_t reg) {
+	if (reg <= VirtualMachine::Z && reg % 7 == 0)
+		return reg / 7;
+	return -1;
+}
+
+Jit::Jit (VirtualMachine *VM) :
+	VM (VM) {
+#ifdef _WIN32
+	this->code = (uint8_t *) VirtualAlloc (NULL, code_size, MEM_COMMIT | MEM_RESERVE, PAGE_EXECUTE_READWRITE);
+#else
+	this->code = (uint8_t *) mmap (NULL, code_size, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (this->code == MAP_FAILED)
+		this->code = nullptr;
+#endif
+}
+
+Jit::~Jit () {
+	this->Flush ();
+#ifdef _WIN32
+	VirtualFree (this->code, 0, MEM_RELEASE);
+#else
+	if (this->code != nullptr)
+		munmap (this->code, code_size);
+#endif
+}
+
+void Jit::Flush () {
+	for (block *b : this->blocks) {
+		VirtualMachine::decoded *entry = &VM->decode_cache[b->start & (VirtualMachine::decode_cache_size - 1)];
+		if (entry->block == b)
+			entry->block = nullptr;
+		delete b;
+	}
+	this->blocks.clear ();
+	this->used = 0;
+}
+
+void Jit::Invalidate (uint32_t page) {
+	for (size_t i = 0; i < this->blocks.size (); ) {
+		block *b = this->blocks[i];
+		if ((b->start >> GUEST_PAGE_SHIFT) <= page && ((b->end - 1) >> GUEST_PAGE_SHIFT) >= page) {
+			VirtualMachine::decoded *entry = &VM->decode_cache[b->start & (VirtualMachine::decode_cache_size - 1)];
+			if (entry->block == b)
+				entry->block = nullptr;
+			delete b;
+			this->blocks[i] = this->blocks.back ();
+			this->blocks.pop_back ();
+		} else
+			i++;
+	}
+}
+
+bool Jit::Translate (uint32_t address, op &out) {
+	if (!VM->memory->IsRAM (address, VirtualMachine::max_instruction_length))
+		return false;
+
+	const uint8_t *bytes = VM->memory->memory + address;
+	out.opcode = bytes[0];
+
+	switch (out.opcode) {
+		case VirtualMachine::nop:
+			out.next = address + 1;
+			return true;
+		case VirtualMachine::mov:
+		case VirtualMachine::add:
+		case VirtualMachine::mul:
+		case VirtualMachine::or:
+		case VirtualMachine::cmp:
+		{
+			out.mode = bytes[1];
+			out.sz = bytes[2];
+			if (out.sz > VirtualMachine::qword || slot (bytes[3]) < 0)
+				return false;
+			out.a = slot (bytes[3]);
+
+			if (out.mode == VirtualMachine::RegisterRegister) {
+				if ((out.opcode != VirtualMachine::mov && out.opcode != VirtualMachine::add) || slot (bytes[4]) < 0)
+					return false;
+				out.b = slot (bytes[4]);
+				out.next = address + 5;
+				return true;
+			}
+			if (out.mode != VirtualMachine::RegisterImmediate)
+				return false;
+
+			int length = 1 << out.sz;
+			out.imm = 0;
+			for (int i = 0; i < length; i++)
+				out.imm |= bytes[4 + i] << (i * 8);
+			out.next = address + 4 + length;
+			return true;
+		}
+		case VirtualMachine::inc:
+		case VirtualMachine::xor:
+			out.mode = bytes[1];
+			if (out.mode != VirtualMachine::Register || slot (bytes[2]) < 0)
+				return false;
+			out.a = slot (bytes[2]);
+			out.next = address + 3;
+			return true;
+		case VirtualMachine::shl:
+			out.mode = bytes[1];
+			if (out.mode != VirtualMachine::RegisterImmediate || slot (bytes[2]) < 0)
+				return false;
+			out.a = slot (bytes[2]);
+			out.imm = bytes[3];
+			out.next = address + 4;
+			return true;
+		case VirtualMachine::jmp:
+		case VirtualMachine::je:
+		case VirtualMachine::jne:
+		case VirtualMachine::jl:
+			out.mode = bytes[1];
+			if (out.mode != VirtualMachine::Immediate)
+				return false;
+			out.imm = bytes[2] | (bytes[3] << 8) | (bytes[4] << 16) | ((uint32_t) bytes[5] << 24);
+			out.next = address + 6;
+			return true;
+		default:
+			return false;
+	}
+}
+
+void Jit::Prologue (uint8_t *&p, uint16_t used) {
+	for (int reg : saved_reg) {
+		rex (p, 0, reg);
+		emit8 (p, 0x50 + (reg & 7));
+	}
+
+#ifdef _WIN32
+	emit8 (p, 0x48); emit8 (p, 0x89); emit8 (p, 0xCB);	// mov rbx, rcx
+#else
+	emit8 (p, 0x48); emit8 (p, 0x89); emit8 (p, 0xFB);	// mov rbx, rdi
+#endif
+
+	for (int i = 0; i < 10; i++)
+		if (used & (1 << i))
+			load (p, host_reg[i], REG_OFFSET (i));
+}
+
+void Jit::Exit (uint8_t *&p, uint16_t written, uint32_t pc) {
+	for (int i = 0; i < 10; i++)
+		if (written & (1 << i))
+			store (p, REG_OFFSET (i), host_reg[i]);
+
+	emit8 (p, 0xC7);	// mov dword [rbx + PC], pc
+	modrm (p, 2, 0, RBX);
+	emit32 (p, PC_OFFSET);
+	emit32 (p, pc);
+
+	for (int i = sizeof (saved_reg) / sizeof (saved_reg[0]) - 1; i >= 0; i--) {
+		rex (p, 0, saved_reg[i]);
+		emit8 (p, 0x58 + (saved_reg[i] & 7));
+	}
+	emit8 (p, 0xC3);
+}
+
+Jit::block *Jit::Compile (uint32_t address) {
+	if (this->code == nullptr)
+		return nullptr;
+
+	std::vector<op> ops;
+	uint16_t used = 0, written = 0;
+	uint32_t pc = address;
+
+	while (ops.size () < max_block_length) {
+		op o;
+		if (!this->Translate (pc, o))
+			break;
+
+		ops.push_back (o);
+		pc = o.next;
+
+		switch (o.opcode) {
+			case VirtualMachine::nop:
+			case VirtualMachine::jmp:
+			case VirtualMachine::je:
+			case VirtualMachine::jne:
+			case VirtualMachine::jl:
+				break;
+			case VirtualMachine::cmp:
+				used |= 1 << o.a;
+				break;
+			case VirtualMachine::xor:
+				written |= 1 << o.a;
+				break;
+			case VirtualMachine::mov:
+				if (o.mode == VirtualMachine::RegisterRegister)
+					used |= (1 << o.a) | (1 << o.b);
+				written |= 1 << o.a;
+				break;
+			default:
+				used |= 1 << o.a;
+				if (o.mode == VirtualMachine::RegisterRegister)
+					used |= 1 << o.b;
+				written |= 1 << o.a;
+				break;
+		}
+
+		if (o.opcode == VirtualMachine::jmp || o.opcode == VirtualMachine::je ||
+			o.opcode == VirtualMachine::jne || o.opcode == VirtualMachine::jl)
+			break;
+	}
+
+	if (ops.empty ())
+		return nullptr;
+
+	if (code_size - this->used < max_block_size)
+		this->Flush ();
+
+	uint8_t *start = this->code + this->used;
+	uint8_t *p = start;
+
+	this->Prologue (p, used);
+
+	bool exited = false;
+	for (const op &o : ops) {
+		int a = host_reg[o.a];
+		switch (o.opcode) {
+			case VirtualMachine::nop:
+				break;
+			case VirtualMachine::mov:
+				if (o.mode == VirtualMachine::RegisterImmediate)
+					mov_ri (p, a, o.imm);
+				else if (o.sz == VirtualMachine::word) {
+					alu_rr (p, 0x89, EAX, host_reg[o.b]);
+					alu_ri (p, 4, EAX, 0x000000FF);
+					alu_ri (p, 4, a, 0xFFFFFF00);
+					alu_rr (p, 0x09, a, EAX);
+				} else if (o.sz == VirtualMachine::dword) {
+					alu_rr (p, 0x89, EAX, host_reg[o.b]);
+					alu_ri (p, 4, EAX, 0x0000FFFF);
+					alu_ri (p, 4, a, 0xFFFF0000);
+					alu_rr (p, 0x09, a, EAX);
+				} else {
+					// set_reg_reg only carries the low 16 bits for qword
+					alu_rr (p, 0x89, a, host_reg[o.b]);
+					alu_ri (p, 4, a, 0x0000FFFF);
+				}
+				break;
+			case VirtualMachine::add:
+				if (o.mode == VirtualMachine::RegisterRegister)
+					alu_rr (p, 0x01, a, host_reg[o.b]);
+				else
+					alu_ri (p, 0, a, o.imm);
+				break;
+			case VirtualMachine::mul:
+				rex (p, a, a);
+				emit8 (p, 0x69);
+				modrm (p, 3, a, a);
+				emit32 (p, o.imm);
+				break;
+			case VirtualMachine::or:
+				alu_ri (p, 1, a, o.imm);
+				break;
+			case VirtualMachine::xor:
+				alu_rr (p, 0x31, a, a);
+				break;
+			case VirtualMachine::inc:
+				alu_ri (p, 0, a, 1);
+				break;
+			case VirtualMachine::shl:
+				rex (p, 0, a);
+				emit8 (p, 0xC1);
+				modrm (p, 3, 4, a);
+				emit8 (p, o.imm);
+				break;
+			case VirtualMachine::cmp:
+				// Flags = Zero | Underflow | Parity, matching VirtualMachine::CMP
+				alu_rr (p, 0x89, ECX, a);
+				alu_ri (p, 5, ECX, o.imm);
+				emit8 (p, 0x0F); emit8 (p, 0x94); emit8 (p, 0xC0);	// sete al
+				emit8 (p, 0x0F); emit8 (p, 0x92); emit8 (p, 0xC2);	// setb dl
+				emit8 (p, 0x0F); emit8 (p, 0xB6); emit8 (p, 0xC0);	// movzx eax, al
+				emit8 (p, 0x0F); emit8 (p, 0xB6); emit8 (p, 0xD2);	// movzx edx, dl
+				alu_rr (p, 0x01, EDX, EDX);
+				alu_rr (p, 0x09, EAX, EDX);
+				emit8 (p, 0xF7); modrm (p, 3, 2, ECX);				// not ecx
+				alu_ri (p, 4, ECX, 1);
+				emit8 (p, 0xC1); modrm (p, 3, 4, ECX); emit8 (p, 3);	// shl ecx, 3
+				alu_rr (p, 0x09, EAX, ECX);
+				emit8 (p, 0x66); emit8 (p, 0x89);					// mov [rbx + Flags], ax
+				modrm (p, 2, EAX, RBX);
+				emit32 (p, FLAGS_OFFSET);
+				break;
+			case VirtualMachine::jmp:
+				this->Exit (p, written, o.imm);
+				exited = true;
+				break;
+			case VirtualMachine::je:
+			case VirtualMachine::jne:
+			case VirtualMachine::jl:
+			{
+				uint16_t mask = o.opcode == VirtualMachine::jl ? VirtualMachine::Underflow : VirtualMachine::Zero;
+				emit8 (p, 0x66); emit8 (p, 0xF7);					// test word [rbx + Flags], mask
+				modrm (p, 2, 0, RBX);
+				emit32 (p, FLAGS_OFFSET);
+				emit16 (p, mask);
+
+				// Skip the taken exit when the condition does not hold
+				emit8 (p, 0x0F);
+				emit8 (p, o.opcode == VirtualMachine::jne ? 0x85 : 0x84);
+				uint8_t *fixup = p;
+				emit32 (p, 0);
+
+				this->Exit (p, written, o.imm);
+				int32_t rel = (int32_t) (p - (fixup + 4));
+				memcpy (fixup, &rel, 4);
+				this->Exit (p, written, o.next);
+				exited = true;
+				break;
+			}
+		}
+	}
+
+	if (!exited)
+		this->Exit (p, written, ops.back ().next);
+
+	this->used += (uint32_t) (p - start);
+
+	block *b = new block ();
+	b->start = address;
+	b->end = ops.back ().next;
+	b->count = (uint32_t) ops.size ();
+	b->code = (native) start;
+	this->blocks.push_back (b);
+
+	VM->memory->MarkCode (b->start, b->end - b->start);
+	return b;
+}
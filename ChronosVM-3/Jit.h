@@ -0,0 +1,60 @@
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+class VirtualMachine;
+
+// Blocks are only translated on x86-64 hosts; everything else stays interpreted
+#if defined(_M_X64) || defined(__x86_64__)
+#define VM_JIT
+#endif
+
+class Jit {
+public:
+	typedef void (*native) (void *registers);
+
+	struct block {
+		uint32_t start;
+		uint32_t end;
+		uint32_t count;
+		native code;
+	};
+
+	Jit (VirtualMachine *VM);
+	~Jit ();
+
+	block *Compile (uint32_t address);
+	void Invalidate (uint32_t page);
+	void Flush ();
+
+	inline uint32_t Run (block *b, void *registers) { b->code (registers); return b->count; }
+
+	// Executions of an instruction before a block is translated from it
+	static const int threshold = 64;
+	static const int max_block_length = 64;
+	static const uint32_t code_size = 4 * 1024 * 1024;
+	static const uint32_t max_block_size = 8 * 1024;
+private:
+	struct op {
+		uint8_t opcode;
+		uint8_t mode;
+		uint8_t sz;
+		uint8_t a;
+		uint8_t b;
+		uint32_t imm;
+		uint32_t next;
+	};
+
+	bool Translate (uint32_t address, op &out);
+
+	void Prologue (uint8_t *&p, uint16_t used);
+	void Exit (uint8_t *&p, uint16_t written, uint32_t pc);
+
+	VirtualMachine *VM;
+
+	uint8_t *code;
+	uint32_t used = 0;
+
+	std::vector<block *> blocks;
+};
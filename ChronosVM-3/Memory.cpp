@@ -1,59 +1,307 @@
-#include "Memory.h"
-
-
-
-Memory::Memory (uint32_t size) :
-	size (size) {
-	memory = new uint8_t[this->size];
-}
-
-
-Memory::~Memory () { 
-	delete[] memory;
-}
-
-#define TryWriteMMIO(addr, val, t) for (auto *region : this->mmio) \
-									if (region->ContainsAddress (addr)) { \
-										region->write##t## (addr, addr - region->GetAddress (), val); \
-										return; \
-									}
-#define TryReadMMIO(addr, t) for (auto *region : this->mmio) \
-									if (region->ContainsAddress (addr)) \
-										return region->read##t## (addr, addr - region->GetAddress ());
-
-void Memory::writew (uint32_t addr, uint8_t val) {
-	TryWriteMMIO (addr, val, w)
-									else {
-		this->memory[addr] = val;
-	}
-}
-void Memory::writed (uint32_t addr, uint16_t val) {
-	TryWriteMMIO (addr, val, d)
-									else {
-		this->writew (addr + 0, (val & 0x00FF) >> 0);
-		this->writew (addr + 1, (val & 0xFF00) >> 8);
-	}
-}
-void Memory::writeq (uint32_t addr, uint32_t val) {
-	TryWriteMMIO (addr, val, q)
-									else {
-		this->writed (addr + 0, (val & 0x0000FFFF) >> 00);
-		this->writed (addr + 2, (val & 0xFFFF0000) >> 16);
-	}
-}
-
-uint8_t Memory::readw (uint32_t addr) {
-	TryReadMMIO (addr, w);
-
-	return this->memory[addr];
-}
-uint16_t Memory::readd (uint32_t addr) {
-	TryReadMMIO (addr, d);
-
-	return this->readw (addr) | this->readw (addr + 1) << 8;
-}
-uint32_t Memory::readq (uint32_t addr) {
-	TryReadMMIO (addr, q);
-
-	return this->readd (addr) | this->readd (addr + 2) << 16;
-}
+#include "Memory.h"
+
+#include <string.h>
+#include <mutex>
+#include <new>
+
+#if defined(VM_GUARD_PAGES) && defined(_WIN32)
+#include <windows.h>
+#elif defined(VM_GUARD_PAGES)
+#include <sys/mman.h>
+#include <signal.h>
+#include <setjmp.h>
+#endif
+
+#if defined(VM_GUARD_PAGES) && defined(_WIN32)
+// Reservations are committed a host page at a time on first touch, from any thread
+static std::mutex reserved_lock;
+static std::vector<Memory *> reserved;
+
+static LONG CALLBACK CommitOnTouch (PEXCEPTION_POINTERS info) {
+	if (info->ExceptionRecord->ExceptionCode != EXCEPTION_ACCESS_VIOLATION)
+		return EXCEPTION_CONTINUE_SEARCH;
+
+	uint8_t *addr = (uint8_t *) info->ExceptionRecord->ExceptionInformation[1];
+	std::lock_guard<std::mutex> guard (reserved_lock);
+	for (Memory *memory : reserved)
+		if (addr >= memory->memory && addr < memory->memory + memory->GetSize ())
+			if (VirtualAlloc (addr, 1, MEM_COMMIT, PAGE_READWRITE) != NULL)
+				return EXCEPTION_CONTINUE_EXECUTION;
+
+	return EXCEPTION_CONTINUE_SEARCH;
+}
+
+static int GuestFault (PEXCEPTION_POINTERS info, uint8_t *base) {
+	uint8_t *addr = (uint8_t *) info->ExceptionRecord->ExceptionInformation[1];
+	if (info->ExceptionRecord->ExceptionCode == EXCEPTION_ACCESS_VIOLATION &&
+		addr >= base && addr < base + Memory::address_space)
+		return EXCEPTION_EXECUTE_HANDLER;
+	return EXCEPTION_CONTINUE_SEARCH;
+}
+#elif defined(VM_GUARD_PAGES)
+// The innermost Guard on this thread; SIGSEGV inside its reservation unwinds to it
+static thread_local sigjmp_buf *armed = nullptr;
+static thread_local uint8_t *armed_base = nullptr;
+static struct sigaction previous;
+
+static void GuestFault (int signal, siginfo_t *info, void *context) {
+	uint8_t *addr = (uint8_t *) info->si_addr;
+	if (armed != nullptr && addr >= armed_base && addr < armed_base + Memory::address_space)
+		siglongjmp (*armed, 1);
+
+	// Not a guest access; hand it to whoever had the signal before us, staying installed
+	if (previous.sa_flags & SA_SIGINFO) {
+		previous.sa_sigaction (signal, info, context);
+		return;
+	}
+	if (previous.sa_handler != SIG_DFL && previous.sa_handler != SIG_IGN) {
+		previous.sa_handler (signal);
+		return;
+	}
+
+	// A real crash with nobody else to catch it; die the default way
+	struct sigaction fallback;
+	memset (&fallback, 0, sizeof (fallback));
+	fallback.sa_handler = SIG_DFL;
+	sigemptyset (&fallback.sa_mask);
+	sigaction (signal, &fallback, nullptr);
+	raise (signal);
+}
+#endif
+
+// RAM is always whole pages, so the last one gets the fast path and the
+// guard-page protection like the rest; 0xFFFFF becomes 0x100000
+static uint32_t WholePages (uint32_t size) {
+	uint64_t rounded = ((uint64_t) size + GUEST_PAGE_MASK) & ~(uint64_t) GUEST_PAGE_MASK;
+	return rounded > Memory::address_space - GUEST_PAGE_SIZE ? (uint32_t) (Memory::address_space - GUEST_PAGE_SIZE) : (uint32_t) rounded;
+}
+
+Memory::Memory (uint32_t size) :
+	size (WholePages (size)) {
+#if defined(VM_GUARD_PAGES) && defined(_WIN32)
+	static std::once_flag installed;
+	std::call_once (installed, [] { AddVectoredExceptionHandler (1, CommitOnTouch); });
+
+	this->memory = (uint8_t *) VirtualAlloc (NULL, address_space, MEM_RESERVE, PAGE_NOACCESS);
+	if (this->memory == NULL)
+		throw std::bad_alloc ();
+
+	std::lock_guard<std::mutex> guard (reserved_lock);
+	reserved.push_back (this);
+#elif defined(VM_GUARD_PAGES)
+	static std::once_flag installed;
+	std::call_once (installed, [] {
+		struct sigaction action;
+		memset (&action, 0, sizeof (action));
+		action.sa_sigaction = GuestFault;
+		action.sa_flags = SA_SIGINFO | SA_NODEFER;
+		sigemptyset (&action.sa_mask);
+		sigaction (SIGSEGV, &action, &previous);
+	});
+
+	// Anonymous mappings are only backed once touched, so RAM is committed lazily by the kernel
+	this->memory = (uint8_t *) mmap (NULL, address_space, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+	if (this->memory == MAP_FAILED || mprotect (this->memory, this->size, PROT_READ | PROT_WRITE) != 0)
+		throw std::bad_alloc ();
+#else
+	this->memory = new uint8_t[this->size] ();
+#endif
+	this->Map ();
+}
+
+
+Memory::~Memory () { 
+#if defined(VM_GUARD_PAGES) && defined(_WIN32)
+	{
+		std::lock_guard<std::mutex> guard (reserved_lock);
+		for (size_t i = 0; i < reserved.size (); i++)
+			if (reserved[i] == this)
+				reserved.erase (reserved.begin () + i);
+	}
+	VirtualFree (this->memory, 0, MEM_RELEASE);
+#elif defined(VM_GUARD_PAGES)
+	munmap (this->memory, address_space);
+#else
+	delete[] memory;
+#endif
+}
+
+#if defined(VM_GUARD_PAGES) && defined(_WIN32)
+bool Memory::Guard (void (*body) (void *context), void *context) {
+	__try {
+		body (context);
+	}
+	__except (GuestFault (GetExceptionInformation (), this->memory)) {
+		return false;
+	}
+	return true;
+}
+#elif defined(VM_GUARD_PAGES)
+bool Memory::Guard (void (*body) (void *context), void *context) {
+	sigjmp_buf buffer;
+	sigjmp_buf *outer = armed;
+	uint8_t *outer_base = armed_base;
+
+	if (sigsetjmp (buffer, 0) != 0) {
+		armed = outer;
+		armed_base = outer_base;
+		return false;
+	}
+
+	armed = &buffer;
+	armed_base = this->memory;
+	body (context);
+	armed = outer;
+	armed_base = outer_base;
+	return true;
+}
+#else
+bool Memory::Guard (void (*body) (void *context), void *context) {
+	this->faulted = false;
+	body (context);
+	return !this->faulted;
+}
+#endif
+
+void Memory::Map () {
+	uint64_t limit = this->size;
+	for (auto *region : this->mmio)
+		if (region->GetEnd () > limit)
+			limit = region->GetEnd ();
+
+	this->pages.assign ((size_t) ((limit + GUEST_PAGE_SIZE - 1) >> GUEST_PAGE_SHIFT), page ());
+
+	for (size_t i = 0; i < this->pages.size (); i++) {
+		uint32_t base = (uint32_t) (i << GUEST_PAGE_SHIFT);
+		page &p = this->pages[i];
+
+		int overlapping = 0;
+		for (auto *region : this->mmio)
+			if (base < region->GetEnd () && base + GUEST_PAGE_SIZE > region->GetAddress ()) {
+				p.region = region;
+				overlapping++;
+			}
+
+		if (overlapping > 1)
+			p.region = nullptr;
+		if (overlapping == 0 && (uint64_t) base + GUEST_PAGE_SIZE <= this->size)
+			p.ram = this->memory + base;
+	}
+}
+
+MemoryRegion *Memory::RegionAt (uint32_t addr) {
+	uint32_t index = addr >> GUEST_PAGE_SHIFT;
+	if (index < this->pages.size ()) {
+		page &p = this->pages[index];
+		if (p.ram != nullptr)
+			return nullptr;
+		if (p.region != nullptr && p.region->ContainsAddress (addr))
+			return p.region;
+	}
+
+	for (auto *region : this->mmio)
+		if (region->ContainsAddress (addr))
+			return region;
+	return nullptr;
+}
+
+void Memory::writew (uint32_t addr, uint8_t val) {
+	uint32_t index = addr >> GUEST_PAGE_SHIFT;
+	if (index < this->pages.size () && this->pages[index].ram != nullptr) {
+		this->pages[index].ram[addr & GUEST_PAGE_MASK] = val;
+		this->Written (addr);
+		return;
+	}
+
+	if (MemoryRegion *region = this->RegionAt (addr))
+		region->writew (addr, addr - region->GetAddress (), val);
+	else
+		this->Unmapped (addr) = val;
+}
+void Memory::writed (uint32_t addr, uint16_t val) {
+	if (uint8_t *host = this->RAMAt (addr, 2)) {
+		memcpy (host, &val, 2);
+		this->Written (addr);
+		return;
+	}
+
+	if (MemoryRegion *region = this->RegionAt (addr)) {
+		region->writed (addr, addr - region->GetAddress (), val);
+		return;
+	}
+
+	this->writew (addr + 0, (val & 0x00FF) >> 0);
+	this->writew (addr + 1, (val & 0xFF00) >> 8);
+}
+void Memory::writeq (uint32_t addr, uint32_t val) {
+	if (uint8_t *host = this->RAMAt (addr, 4)) {
+		memcpy (host, &val, 4);
+		this->Written (addr);
+		return;
+	}
+
+	if (MemoryRegion *region = this->RegionAt (addr)) {
+		region->writeq (addr, addr - region->GetAddress (), val);
+		return;
+	}
+
+	this->writed (addr + 0, (val & 0x0000FFFF) >> 00);
+	this->writed (addr + 2, (val & 0xFFFF0000) >> 16);
+}
+
+uint8_t Memory::readw (uint32_t addr) {
+	uint32_t index = addr >> GUEST_PAGE_SHIFT;
+	if (index < this->pages.size () && this->pages[index].ram != nullptr)
+		return this->pages[index].ram[addr & GUEST_PAGE_MASK];
+
+	if (MemoryRegion *region = this->RegionAt (addr))
+		return region->readw (addr, addr - region->GetAddress ());
+	return this->Unmapped (addr);
+}
+uint16_t Memory::readd (uint32_t addr) {
+	if (uint8_t *host = this->RAMAt (addr, 2)) {
+		uint16_t val;
+		memcpy (&val, host, 2);
+		return val;
+	}
+
+	if (MemoryRegion *region = this->RegionAt (addr))
+		return region->readd (addr, addr - region->GetAddress ());
+
+	return this->readw (addr) | this->readw (addr + 1) << 8;
+}
+uint32_t Memory::readq (uint32_t addr) {
+	if (uint8_t *host = this->RAMAt (addr, 4)) {
+		uint32_t val;
+		memcpy (&val, host, 4);
+		return val;
+	}
+
+	if (MemoryRegion *region = this->RegionAt (addr))
+		return region->readq (addr, addr - region->GetAddress ());
+
+	return this->readd (addr) | this->readd (addr + 2) << 16;
+}
+
+bool Memory::IsRAM (uint32_t addr, uint32_t length) {
+	for (uint64_t page = addr >> GUEST_PAGE_SHIFT; page <= ((uint64_t) addr + length - 1) >> GUEST_PAGE_SHIFT; page++)
+		if (page >= this->pages.size () || this->pages[(size_t) page].ram == nullptr)
+			return false;
+
+	return true;
+}
+
+bool Memory::IsRegion (uint32_t addr, uint32_t length) {
+	MemoryRegion *region = this->RegionAt (addr);
+	return region != nullptr && (uint64_t) addr + length <= (uint64_t) region->GetAddress () + region->GetSize ();
+}
+
+void Memory::Written (uint32_t addr, uint32_t length) {
+	for (uint32_t page = addr >> GUEST_PAGE_SHIFT; page <= (addr + length - 1) >> GUEST_PAGE_SHIFT; page++)
+		this->Written (page << GUEST_PAGE_SHIFT);
+}
+
+void Memory::MarkCode (uint32_t addr, uint32_t length) {
+	for (uint32_t page = addr >> GUEST_PAGE_SHIFT; page <= (addr + length - 1) >> GUEST_PAGE_SHIFT; page++)
+		this->pages[page].code = true;
+}
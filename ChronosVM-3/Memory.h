@@ -1,28 +1,102 @@
-#pragma once
-
-#include <stdint.h>
-#include <vector>
-
-#include "MemoryRegion.h"
-
-class Memory {
-public:
-	Memory (uint32_t size);
-	~Memory ();
-
-	inline void AddMemoryRegion (MemoryRegion *region) { this->mmio.push_back (region); }
-
-	void writew (uint32_t, uint8_t);
-	void writed (uint32_t, uint16_t);
-	void writeq (uint32_t, uint32_t);
-
-	uint8_t readw (uint32_t);
-	uint16_t readd (uint32_t);
-	uint32_t readq (uint32_t);
-
-	uint8_t *memory;
-private:
-	uint32_t size;
-	std::vector<MemoryRegion *> mmio;
-};
-
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+#include <functional>
+
+#include "MemoryRegion.h"
+
+// Guest memory is mapped in 256 byte pages; code is tracked at the same granularity
+#define GUEST_PAGE_SHIFT 8
+#define GUEST_PAGE_SIZE (1 << GUEST_PAGE_SHIFT)
+#define GUEST_PAGE_MASK (GUEST_PAGE_SIZE - 1)
+
+// On 64-bit hosts the whole 32-bit guest address space is reserved up front and only
+// the RAM range is made accessible, so accesses past the end of RAM trap in hardware
+// instead of being bounds checked. 32-bit hosts fall back to an explicit check.
+#if defined(_M_X64) || defined(__x86_64__) || defined(__aarch64__)
+#define VM_GUARD_PAGES
+#endif
+
+class Memory {
+public:
+	// size is rounded up to whole guest pages
+	Memory (uint32_t size);
+	~Memory ();
+
+	inline void AddMemoryRegion (MemoryRegion *region) { this->mmio.push_back (region); this->Map (); }
+
+	void writew (uint32_t, uint8_t);
+	void writed (uint32_t, uint16_t);
+	void writeq (uint32_t, uint32_t);
+
+	uint8_t readw (uint32_t);
+	uint16_t readd (uint32_t);
+	uint32_t readq (uint32_t);
+
+	bool IsRAM (uint32_t addr, uint32_t length);
+	// True if the whole range falls inside one memory region
+	bool IsRegion (uint32_t addr, uint32_t length);
+	void MarkCode (uint32_t addr, uint32_t length);
+	// Called after RAM was written through the memory pointer rather than write*
+	void Written (uint32_t addr, uint32_t length);
+
+	// Runs body with guest memory faults trapped; returns false if it touched
+	// an address that is neither RAM nor a memory region
+	bool Guard (void (*body) (void *context), void *context);
+
+	inline uint32_t GetSize () const { return this->size; }
+
+	static const uint64_t address_space = 0x100000000ULL;
+
+	uint8_t *memory;
+
+	std::function<void (uint32_t page)> CodeWritten = nullptr;
+private:
+	// ram points at the host bytes of a page that is plain RAM; region is
+	// set when exactly one MemoryRegion overlaps the page
+	struct page {
+		uint8_t *ram = nullptr;
+		MemoryRegion *region = nullptr;
+		bool code = false;
+	};
+
+	void Map ();
+	MemoryRegion *RegionAt (uint32_t addr);
+
+	// Host pointer for a guest access of length bytes that stays inside one RAM page.
+	// Guest memory is little-endian like every host we build for, so wide accesses are a memcpy.
+	inline uint8_t *RAMAt (uint32_t addr, uint32_t length) {
+		uint32_t index = addr >> GUEST_PAGE_SHIFT;
+		if (index < this->pages.size () && this->pages[index].ram != nullptr && (addr & GUEST_PAGE_MASK) <= GUEST_PAGE_SIZE - length)
+			return this->pages[index].ram + (addr & GUEST_PAGE_MASK);
+		return nullptr;
+	}
+	// Backing byte for an address the page table has no RAM page for
+	inline uint8_t &Unmapped (uint32_t addr) {
+#ifndef VM_GUARD_PAGES
+		if (addr >= this->size) {
+			this->faulted = true;
+			return this->scratch;
+		}
+#endif
+		return this->memory[addr];
+	}
+	inline void Written (uint32_t addr) {
+		page &p = this->pages[addr >> GUEST_PAGE_SHIFT];
+		if (p.code) {
+			p.code = false;
+			if (this->CodeWritten != nullptr)
+				this->CodeWritten (addr >> GUEST_PAGE_SHIFT);
+		}
+	}
+
+	uint32_t size;
+	std::vector<page> pages;
+	std::vector<MemoryRegion *> mmio;
+
+#ifndef VM_GUARD_PAGES
+	bool faulted = false;
+	uint8_t scratch;
+#endif
+};
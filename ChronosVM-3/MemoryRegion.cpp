@@ -1,10 +1,10 @@
-#include "MemoryRegion.h"
-
-
-
-MemoryRegion::MemoryRegion (uint32_t start, uint32_t size) :
-	start (start),
-	size (size) { }
-
-
-MemoryRegion::~MemoryRegion () { }
+#include "MemoryRegion.h"
+
+
+
+MemoryRegion::MemoryRegion (uint32_t start, uint32_t size) :
+	start (start),
+	size (size) { }
+
+
+MemoryRegion::~MemoryRegion () { }
@@ -0,0 +1,109 @@
+#include "OverlayImage.h"
+
+#include <string.h>
+
+static const char overlay_magic[4] = { 'C', 'V', 'M', 'O' };
+static const uint32_t overlay_version = 1;
+
+OverlayImage::OverlayImage (DiskImage *base, const char *path) :
+	base (base),
+	sectors (base->GetSectors ()) {
+	uint64_t index_size = (this->sectors * sizeof (uint32_t) + sector_size - 1) / sector_size * sector_size;
+	this->slots_offset = sector_size + index_size;
+
+	this->overlay = new DiskImage (path, this->slots_offset + this->sectors * sector_size);
+
+	uint8_t *data = this->overlay->GetData ();
+	this->head = (header *) data;
+	this->index = (uint32_t *) (data + sector_size);
+	this->slots = data + this->slots_offset;
+
+	if (memcmp (this->head->magic, overlay_magic, sizeof (overlay_magic)) != 0 ||
+		this->head->version != overlay_version || this->head->sectors != this->sectors) {
+		// A new file reads as zeroes already; clearing it would only allocate the index
+		if (this->head->sectors != 0)
+			memset (this->index, 0, (size_t) index_size);
+		memcpy (this->head->magic, overlay_magic, sizeof (overlay_magic));
+		this->head->version = overlay_version;
+		this->head->sectors = this->sectors;
+		this->head->used = 0;
+		this->overlay->FlushRange (0, this->slots_offset);
+	}
+}
+
+OverlayImage::~OverlayImage () {
+	delete this->overlay;
+}
+
+uint8_t *OverlayImage::Map (uint64_t lba, uint64_t &sectors, bool write, bool whole) {
+	if (lba >= this->sectors)
+		return nullptr;
+	if (sectors > this->sectors - lba)
+		sectors = this->sectors - lba;
+	if (sectors == 0)
+		sectors = 1;
+
+	std::lock_guard<std::mutex> guard (this->lock);
+	uint32_t slot = this->index[lba];
+	uint64_t run = 1;
+
+	if (slot != 0) {
+		// Slots allocated together for consecutive sectors stay consecutive
+		while (run < sectors && this->index[lba + run] == slot + run)
+			run++;
+		sectors = run;
+		return this->slots + (uint64_t) (slot - 1) * sector_size;
+	}
+
+	while (run < sectors && this->index[lba + run] == 0)
+		run++;
+
+	if (!write) {
+		sectors = run;
+		return this->base->Map (lba, sectors, false, false);
+	}
+
+	// Copy on write: give the whole unwritten run fresh slots at the end,
+	// filled from the base so partial sector stores keep the rest. A caller
+	// overwriting all of it has no use for the old data.
+	uint64_t first = this->head->used;
+	uint8_t *target = this->slots + first * sector_size;
+	for (uint64_t done = 0; done < run && !whole; ) {
+		uint64_t chunk = run - done;
+		const uint8_t *source = this->base->Map (lba + done, chunk, false, false);
+		memcpy (target + done * sector_size, source, (size_t) (chunk * sector_size));
+		done += chunk;
+	}
+	for (uint64_t i = 0; i < run; i++)
+		this->index[lba + i] = (uint32_t) (first + i + 1);
+	this->head->used = first + run;
+
+	sectors = run;
+	return target;
+}
+
+// Data goes out before the index and header that point at it
+void OverlayImage::Flush (uint64_t lba, uint64_t sectors) {
+	if (lba >= this->sectors)
+		return;
+	if (sectors > this->sectors - lba)
+		sectors = this->sectors - lba;
+
+	std::lock_guard<std::mutex> guard (this->lock);
+	for (uint64_t i = 0; i < sectors; ) {
+		uint32_t slot = this->index[lba + i];
+		if (slot == 0) {
+			i++;
+			continue;
+		}
+
+		uint64_t run = 1;
+		while (i + run < sectors && this->index[lba + i + run] == slot + run)
+			run++;
+		this->overlay->FlushRange (this->slots_offset + (uint64_t) (slot - 1) * sector_size, run * sector_size);
+		i += run;
+	}
+
+	this->overlay->FlushRange (sector_size + lba * sizeof (uint32_t), sectors * sizeof (uint32_t));
+	this->overlay->FlushRange (0, sizeof (header));
+}
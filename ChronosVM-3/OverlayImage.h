@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Disk.h"
+#include "DiskImage.h"
+
+#include <mutex>
+
+// A copy-on-write disk: reads come from a shared read-only base image
+// unless the sector was written, and the first write to a sector copies it
+// into this VM's overlay file. The overlay holds a header, an index from
+// base sector to overlay slot, and the slots in the order they were
+// allocated. It is created sparse at its largest possible size, so disk
+// and memory both grow only with the sectors the VM has written.
+//
+// The base is not owned and must outlive every overlay on it. An overlay
+// made for a base of a different size is started over empty.
+class OverlayImage : public Disk {
+public:
+	OverlayImage (DiskImage *base, const char *path);
+	~OverlayImage ();
+
+	uint8_t *Map (uint64_t lba, uint64_t &sectors, bool write, bool whole);
+	void Flush (uint64_t lba, uint64_t sectors);
+	inline uint64_t GetSectors () const { return this->sectors; }
+
+	// Sectors copied into the overlay so far
+	inline uint64_t GetUsed () const { return this->head->used; }
+private:
+	struct header {
+		char magic[4];
+		uint32_t version;
+		uint64_t sectors;
+		uint64_t used;
+	};
+
+	DiskImage *base;
+	DiskImage *overlay;
+
+	header *head;
+	// Slot + 1 for each base sector, zero while the base still holds it
+	uint32_t *index;
+	uint8_t *slots;
+	uint64_t slots_offset;
+	uint64_t sectors;
+
+	std::mutex lock;
+};
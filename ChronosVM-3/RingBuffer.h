@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+// A fixed-capacity single-producer/single-consumer queue. Push is only called
+// from one thread and Pop from one other; neither ever blocks or allocates.
+// Pushes that do not fit are dropped whole and counted in the overflow total.
+template <typename T, size_t Capacity>
+class RingBuffer {
+	static_assert ((Capacity & (Capacity - 1)) == 0, "RingBuffer capacity must be a power of two");
+public:
+	RingBuffer () :
+		head (0),
+		tail (0),
+		overflows (0) { }
+
+	// Producer: queues all count items or none of them
+	bool Push (const T *items, size_t count) {
+		size_t tail = this->tail.load (std::memory_order_relaxed);
+		size_t head = this->head.load (std::memory_order_acquire);
+		if (Capacity - (tail - head) < count) {
+			this->overflows.fetch_add (1, std::memory_order_relaxed);
+			return false;
+		}
+
+		for (size_t i = 0; i < count; i++)
+			this->items[(tail + i) & (Capacity - 1)] = items[i];
+		this->tail.store (tail + count, std::memory_order_release);
+		return true;
+	}
+	inline bool Push (const T &item) { return this->Push (&item, 1); }
+
+	// Consumer
+	bool Pop (T &item) {
+		size_t head = this->head.load (std::memory_order_relaxed);
+		if (head == this->tail.load (std::memory_order_acquire))
+			return false;
+
+		item = this->items[head & (Capacity - 1)];
+		this->head.store (head + 1, std::memory_order_release);
+		return true;
+	}
+
+	inline size_t Size () const {
+		return this->tail.load (std::memory_order_acquire) - this->head.load (std::memory_order_acquire);
+	}
+	inline bool Empty () const { return this->Size () == 0; }
+
+	// Number of dropped pushes since the last call
+	inline uint32_t TakeOverflows () { return this->overflows.exchange (0); }
+private:
+	T items[Capacity];
+
+	alignas (64) std::atomic<size_t> head;
+	alignas (64) std::atomic<size_t> tail;
+	std::atomic<uint32_t> overflows;
+};
@@ -1,90 +1,471 @@
-#include "Screen.h"
-
-#include <thread>
-
-Screen::Screen (VirtualMachine *VM): 
-	Hardware (VM),
-	MemoryRegion (0xA0000, (160*25) + (256 * 4)) {
-	this->data = new uint8_t[160 * 25 * 2];
-}
-
-Screen::~Screen () { }
-
-void Screen::Start () {
-	Hardware::GetVM ()->RequestPortInb (0x00, [&] (uint8_t value) {
-		this->scale = value;
-	});
-	Hardware::GetVM ()->RequestPortInb (0x01, [&] (uint8_t value) {
-		if (value == 0x01) {
-			if (this->window == nullptr) {
-				std::thread ([&] {SDL SDL (SDL_INIT_VIDEO);
-
-				this->window = new SDLWindow (Hardware::GetVM (), 640 * this->scale, 400 * this->scale, "Virtual Screen");
-				this->texture = new Texture (this->window->GetRenderer (), 640, 400);
-
-				auto updateFunc = [&] () { this->texture->Update (); };
-				auto renderFunc = [&] (SDL_Renderer *renderer) {
-					this->texture->Draw ();
-				};
-
-				this->window->EnterLoop (updateFunc, renderFunc); }).detach ();
-			}
-		}
-	});
-	Hardware::GetVM ()->RequestPortInb (0x02, [&] (uint8_t value) {
-		while (this->texture == nullptr);
-		this->texture->Clear (((uint32_t *) (this->palette))[value]);
-	});
-
-	Hardware::GetVM ()->RequestPortOutb (0x0A, [&] () {
-		VirtualMachine *VM = Hardware::GetVM ();
-		uint8_t state = VM->keyboard.front();
-		VM->keyboard.pop ();
-		return state;
-	});
-}
-
-void Screen::putpixel (uint32_t x, uint32_t y, uint8_t color) {
-	this->texture->GetPixels32 ()[x + y * this->texture->GetWidth ()] = ((uint32_t *) palette)[color];
-}
-
-void Screen::draw_glyph (uint8_t glyph, uint32_t sx, uint32_t sy, uint8_t color) {
-	int i;
-	unsigned int y;
-	unsigned int glline;
-
-	sx *= 8;
-	sy *= 16;
-
-	for (y = 0; y < FONT_SCANLINES; y++) {
-		glline = fb_font[glyph * FONT_SCANLINES + y];
-		for (i = 0; i < 8; i++) {
-			if (glline & (1 << (7 - i)))
-				putpixel (sx + i, sy + y, color & 0x0F);
-			else
-				putpixel (sx + i, sy + y, (color & 0xF0) >> 4);
-		}
-
-	}
-}
-
-
-void Screen::writew (uint32_t absolute, uint32_t relative, uint8_t data) {
-	if (relative >= 0x400) {
-		while (this->texture == nullptr);
-		uint32_t pos = relative - 0x400;
-		this->data[pos] = data;
-		if (pos % 2 == 1)
-			draw_glyph (data, (pos % 160) / 2, (pos / 160), this->data[pos - 1]);
-	}
-	else
-		palette[relative] = data;
-}
-void Screen::writed (uint32_t absolute, uint32_t relative, uint16_t data) {
-	this->writew (absolute, relative, (data & 0x00FF));
-	this->writew (absolute + 1, relative + 1, (data & 0xFF00) >> 8);
-}
-void Screen::writeq (uint32_t absolute, uint32_t relative, uint32_t data) {
-	this->writed (absolute, relative, (data & 0x0000FFFF));
-	this->writed (absolute + 2, relative + 2, (data & 0xFFFF0000) >> 16);
-}
+#include "Screen.h"
+
+#include <thread>
+#include <string.h>
+
+Screen::Screen (VirtualMachine *VM): 
+	Hardware (VM),
+	MemoryRegion (0xA0000, (160*25) + (256 * 4)),
+	ready (false),
+	mode (Text) {
+	this->data = new uint8_t[160 * 25 * 2];
+	memset (this->data, 0, 160 * 25 * 2);
+	for (int i = 0; i < 256 * 256; i++) {
+		this->tiles[i] = nullptr;
+		this->tile_generation[i] = 0;
+	}
+	for (int y = 0; y < rows; y++)
+		this->dirty[y][0] = this->dirty[y][1] = 0;
+}
+
+const std::chrono::microseconds Screen::frame_interval (16667);
+
+Screen::~Screen () {
+	this->Stop ();
+	for (uint32_t *tile : this->tiles)
+		delete[] tile;
+	delete[] this->frame;
+	delete[] this->delivered;
+}
+
+void Screen::SetHeadless (frame_callback on_frame) {
+	this->headless = true;
+	this->on_frame = on_frame;
+	this->texture = new Texture (nullptr, 640, 400);
+	this->frame = new uint32_t[640 * 400];
+	this->delivered = new uint32_t[640 * 400];
+	memcpy (this->frame, this->texture->GetPixels32 (), 640 * 400 * sizeof (uint32_t));
+	memcpy (this->delivered, this->frame, 640 * 400 * sizeof (uint32_t));
+	this->ready = true;
+}
+
+void Screen::SetFramebuffer (Framebuffer *framebuffer) {
+	this->framebuffer = framebuffer;
+}
+
+void Screen::Start () {
+	VirtualMachine *VM = Hardware::GetVM ();
+
+	VM->RequestPortInb<Screen, &Screen::SetScale> (0x00, this);
+	VM->RequestPortInb<Screen, &Screen::Power> (0x01, this);
+	VM->RequestPortInb<Screen, &Screen::Clear> (0x02, this);
+	VM->RequestPortInb<Screen, &Screen::SetMode> (0x03, this);
+
+	VM->RequestPortOutb<Screen, &Screen::ReadKey> (0x0A, this);
+	VM->RequestPortOutsb<Screen, &Screen::ReadKeys> (0x0A, this);
+	VM->RequestPortOutb<Screen, &Screen::ReadKeyDepth> (0x0B, this);
+	VM->RequestPortOutb<Screen, &Screen::ReadKeyOverflows> (0x0C, this);
+}
+
+void Screen::Stop () {
+	if (this->frame_timer != 0)
+		TimerWheel::Shared ().Cancel (this->frame_timer);
+	this->frame_timer = 0;
+	this->StopSink ();
+}
+
+void Screen::StopSink () {
+	if (this->sink == nullptr)
+		return;
+
+	{
+		std::lock_guard<std::mutex> guard (this->frame_lock);
+		this->sink_stop = true;
+		this->frame_wake.notify_all ();
+	}
+	this->sink->join ();
+	delete this->sink;
+	this->sink = nullptr;
+	this->sink_stop = false;
+}
+
+void Screen::SetScale (uint8_t value) {
+	this->scale = value;
+}
+
+void Screen::Power (uint8_t value) {
+	if (value == 0x01) {
+		if (this->headless) {
+			if (this->sink == nullptr && this->on_frame)
+				this->sink = new std::thread (&Screen::Deliver, this);
+			if (this->frame_timer == 0)
+				this->frame_timer = TimerWheel::Shared ().Schedule (frame_interval, TimerWheel::callback::Bind<Screen, &Screen::Frame> (this), true);
+		} else if (this->window == nullptr) {
+			std::thread ([&] {SDL SDL (SDL_INIT_VIDEO);
+
+			this->window = new SDLWindow (Hardware::GetVM (), 640 * this->scale, 400 * this->scale, "Virtual Screen");
+			SDL_Renderer *renderer = this->window->GetRenderer ();
+			this->texture = new Texture (renderer, 640, 400);
+			if (GlyphAtlas::Supported (renderer)) {
+				this->atlas = new GlyphAtlas (renderer, this->fb_font, 640, 400);
+				// The cells cover the whole target, so drawing them all restores it
+				this->window->TargetsReset = [this] { this->MarkAllDirty (); };
+			}
+			this->ready = true;
+
+			auto updateFunc = [&] () { this->Upload (); };
+			auto renderFunc = [&] (SDL_Renderer *renderer) {
+				if (this->atlas != nullptr && this->mode == Text)
+					this->atlas->Draw ();
+				else
+					this->texture->Draw ();
+			};
+
+			this->window->EnterLoop (updateFunc, renderFunc); }).detach ();
+		}
+	}
+}
+
+void Screen::Clear (uint8_t value) {
+	while (!this->ready);
+	if (this->mode == Graphics) {
+		this->framebuffer->Clear (value);
+		return;
+	}
+
+	uint32_t color = ((uint32_t *) (this->palette))[value];
+
+	if (this->atlas != nullptr) {
+		std::lock_guard<std::mutex> guard (this->clear_lock);
+		for (int y = 0; y < rows; y++)
+			this->dirty[y][0] = this->dirty[y][1] = 0;
+		this->clear_pending = true;
+		this->clear_color = color;
+		return;
+	}
+
+	this->texture->Clear (color);
+	this->MarkAllDirty ();
+}
+
+// Graphics needs a framebuffer; without one the screen stays in text mode
+void Screen::SetMode (uint8_t value) {
+	if (value == Graphics && this->framebuffer != nullptr) {
+		if (this->mode.exchange (Graphics) != Graphics)
+			this->framebuffer->MarkAllDirty ();
+	} else if (value == Text) {
+		if (this->mode.exchange (Text) != Text)
+			this->RedrawText ();
+	}
+}
+
+// An empty queue reads as zero
+uint8_t Screen::ReadKey () {
+	uint8_t state = 0;
+	Hardware::GetVM ()->keyboard.Pop (state);
+	return state;
+}
+
+// Drains up to count queued key bytes; the rest of the buffer reads as zero
+void Screen::ReadKeys (uint8_t *data, uint32_t count) {
+	VirtualMachine *VM = Hardware::GetVM ();
+	uint32_t i = 0;
+	while (i < count && VM->keyboard.Pop (data[i]))
+		i++;
+	memset (data + i, 0, count - i);
+}
+
+// Queued key bytes, saturating at 255
+uint8_t Screen::ReadKeyDepth () {
+	size_t depth = Hardware::GetVM ()->keyboard.Size ();
+	return depth > 0xFF ? 0xFF : (uint8_t) depth;
+}
+
+// Key events dropped because the queue was full since the last read, saturating at 255
+uint8_t Screen::ReadKeyOverflows () {
+	uint32_t dropped = Hardware::GetVM ()->keyboard.TakeOverflows ();
+	return dropped > 0xFF ? 0xFF : (uint8_t) dropped;
+}
+
+void Screen::putpixel (uint32_t x, uint32_t y, uint8_t color) {
+	this->texture->GetPixels32 ()[x + y * this->texture->GetWidth ()] = ((uint32_t *) palette)[color];
+}
+
+void Screen::draw_glyph (uint8_t glyph, uint32_t sx, uint32_t sy, uint8_t color) {
+	const int width = this->texture->GetWidth ();
+	const uint32_t *tile = this->GlyphTile (glyph, color);
+
+	uint32_t *row = this->texture->GetPixels32 () + (sy * FONT_SCANLINES) * width + sx * 8;
+	for (int y = 0; y < FONT_SCANLINES; y++, row += width, tile += 8)
+		memcpy (row, tile, 8 * sizeof (uint32_t));
+}
+
+const uint32_t *Screen::GlyphTile (uint8_t glyph, uint8_t color) {
+	uint16_t key = (glyph << 8) | color;
+	uint32_t *&tile = this->tiles[key];
+	if (tile == nullptr)
+		tile = new uint32_t[8 * FONT_SCANLINES];
+	else if (this->tile_generation[key] == this->palette_generation)
+		return tile;
+
+	this->tile_generation[key] = this->palette_generation;
+	this->rasterize (tile, 8, glyph, color);
+	return tile;
+}
+
+void Screen::rasterize (uint32_t *row, int stride, uint8_t glyph, uint8_t color) {
+	const uint32_t fg = ((uint32_t *) palette)[color & 0x0F];
+	const uint32_t bg = ((uint32_t *) palette)[(color & 0xF0) >> 4];
+	const unsigned char *glyph_lines = &fb_font[glyph * FONT_SCANLINES];
+
+#ifdef SCREEN_SSE2
+	// Each scanline byte becomes two vectors of four pixels: broadcast it,
+	// compare against the per-pixel bit and blend fg/bg through the mask
+	const __m128i fg4 = _mm_set1_epi32 ((int) fg);
+	const __m128i bg4 = _mm_set1_epi32 ((int) bg);
+	const __m128i left_bits = _mm_set_epi32 (0x10, 0x20, 0x40, 0x80);
+	const __m128i right_bits = _mm_set_epi32 (0x01, 0x02, 0x04, 0x08);
+
+	for (int y = 0; y < FONT_SCANLINES; y++, row += stride) {
+		const __m128i line = _mm_set1_epi32 (glyph_lines[y]);
+		const __m128i left = _mm_cmpeq_epi32 (_mm_and_si128 (line, left_bits), left_bits);
+		const __m128i right = _mm_cmpeq_epi32 (_mm_and_si128 (line, right_bits), right_bits);
+
+		_mm_storeu_si128 ((__m128i *) row, _mm_or_si128 (_mm_and_si128 (left, fg4), _mm_andnot_si128 (left, bg4)));
+		_mm_storeu_si128 ((__m128i *) (row + 4), _mm_or_si128 (_mm_and_si128 (right, fg4), _mm_andnot_si128 (right, bg4)));
+	}
+#else
+	for (int y = 0; y < FONT_SCANLINES; y++, row += stride) {
+		unsigned int glline = glyph_lines[y];
+		for (int i = 0; i < 8; i++)
+			row[i] = glline & (0x80 >> i) ? fg : bg;
+	}
+#endif
+}
+
+
+void Screen::MarkDirty (uint32_t x, uint32_t y) {
+	if (y < rows)
+		this->dirty[y][x >> 6].fetch_or (1ULL << (x & 63), std::memory_order_release);
+}
+
+void Screen::MarkAllDirty () {
+	for (int y = 0; y < rows; y++) {
+		this->dirty[y][0].store (~0ULL, std::memory_order_release);
+		this->dirty[y][1].store ((1ULL << (columns - 64)) - 1, std::memory_order_release);
+	}
+}
+
+void Screen::Upload () {
+	if (this->mode == Graphics)
+		this->ConvertFramebuffer ();
+	else if (this->atlas != nullptr) {
+		this->RenderCells ();
+		return;
+	} else
+		this->CollectDirtyRects ();
+
+	for (SDL_Rect &rect : this->dirty_rects)
+		this->texture->Update (&rect);
+}
+
+void Screen::Frame () {
+	if (this->mode == Graphics)
+		this->ConvertFramebuffer ();
+	else
+		this->CollectDirtyRects ();
+
+	if (this->dirty_rects.empty () || !this->on_frame)
+		return;
+
+	// The VM thread keeps drawing into the texture, so what changed is
+	// captured now; writing it out is left to the sink thread, which keeps
+	// the wheel free for every other machine's timers
+	const int width = this->texture->GetWidth ();
+	const uint32_t *pixels = this->texture->GetPixels32 ();
+
+	std::lock_guard<std::mutex> guard (this->frame_lock);
+	for (const SDL_Rect &rect : this->dirty_rects)
+		for (int y = rect.y; y < rect.y + rect.h; y++)
+			memcpy (this->frame + y * width + rect.x, pixels + y * width + rect.x, rect.w * sizeof (uint32_t));
+	this->captured.insert (this->captured.end (), this->dirty_rects.begin (), this->dirty_rects.end ());
+	this->frame_wake.notify_one ();
+}
+
+void Screen::Deliver () {
+	const int width = this->texture->GetWidth ();
+	std::vector<SDL_Rect> changed;
+
+	std::unique_lock<std::mutex> guard (this->frame_lock);
+	while (true) {
+		this->frame_wake.wait (guard, [this] { return this->sink_stop || !this->captured.empty (); });
+		if (this->captured.empty ())
+			return;
+
+		// delivered matched frame last time round, so the captured rects are all that differ
+		changed.swap (this->captured);
+		this->captured.clear ();
+		for (const SDL_Rect &rect : changed)
+			for (int y = rect.y; y < rect.y + rect.h; y++)
+				memcpy (this->delivered + y * width + rect.x, this->frame + y * width + rect.x, rect.w * sizeof (uint32_t));
+
+		guard.unlock ();
+		this->on_frame (this->delivered, width, this->texture->GetHeight (), changed);
+		guard.lock ();
+	}
+}
+
+void Screen::CollectDirtyRects () {
+	this->dirty_rects.clear ();
+
+	for (int y = 0; y < rows; y++) {
+		uint64_t bits[2] = {
+			this->dirty[y][0].exchange (0, std::memory_order_acquire),
+			this->dirty[y][1].exchange (0, std::memory_order_acquire)
+		};
+		if ((bits[0] | bits[1]) == 0)
+			continue;
+
+		for (int x = 0; x < columns; ) {
+			if (!(bits[x >> 6] & (1ULL << (x & 63)))) {
+				x++;
+				continue;
+			}
+
+			int start = x;
+			while (x < columns && bits[x >> 6] & (1ULL << (x & 63)))
+				x++;
+
+			SDL_Rect run = { start * 8, y * FONT_SCANLINES, (x - start) * 8, FONT_SCANLINES };
+
+			// Grow a rectangle ending on the row above when it covers the same columns
+			bool merged = false;
+			for (SDL_Rect &rect : this->dirty_rects)
+				if (rect.x == run.x && rect.w == run.w && rect.y + rect.h == run.y) {
+					rect.h += run.h;
+					merged = true;
+					break;
+				}
+			if (!merged)
+				this->dirty_rects.push_back (run);
+		}
+	}
+}
+
+void Screen::ConvertFramebuffer () {
+	uint64_t lines[Framebuffer::line_words];
+	this->dirty_rects.clear ();
+
+	// Back in text mode since the caller looked; RedrawText owns the texture now
+	std::lock_guard<std::mutex> guard (this->texture_lock);
+	if (this->mode != Graphics || !this->framebuffer->TakeDirtyLines (lines))
+		return;
+
+	const uint32_t *colors = (uint32_t *) this->palette;
+	const uint8_t *source = this->framebuffer->GetPixels ();
+	uint32_t *pixels = this->texture->GetPixels32 ();
+
+	for (int y = 0; y < Framebuffer::height; ) {
+		if (!(lines[y >> 6] & (1ULL << (y & 63)))) {
+			y++;
+			continue;
+		}
+
+		int start = y;
+		for (; y < Framebuffer::height && lines[y >> 6] & (1ULL << (y & 63)); y++)
+			expand_line (pixels + y * Framebuffer::width, source + y * Framebuffer::width, colors, Framebuffer::width);
+
+		SDL_Rect run = { 0, start, Framebuffer::width, y - start };
+		this->dirty_rects.push_back (run);
+	}
+}
+
+void Screen::expand_line (uint32_t *out, const uint8_t *in, const uint32_t *colors, int count) {
+	int i = 0;
+#ifdef SCREEN_SSE2
+	// SSE2 has no gather, so the win is on runs: sixteen equal indices (fills,
+	// backgrounds) become four stores of one broadcast colour
+	for (; i + 16 <= count; i += 16) {
+		const __m128i indices = _mm_loadu_si128 ((const __m128i *) (in + i));
+		const __m128i first = _mm_set1_epi8 ((char) in[i]);
+		if (_mm_movemask_epi8 (_mm_cmpeq_epi8 (indices, first)) == 0xFFFF) {
+			const __m128i color = _mm_set1_epi32 ((int) colors[in[i]]);
+			_mm_storeu_si128 ((__m128i *) (out + i + 0), color);
+			_mm_storeu_si128 ((__m128i *) (out + i + 4), color);
+			_mm_storeu_si128 ((__m128i *) (out + i + 8), color);
+			_mm_storeu_si128 ((__m128i *) (out + i + 12), color);
+		} else {
+			for (int j = 0; j < 16; j += 4)
+				_mm_storeu_si128 ((__m128i *) (out + i + j), _mm_setr_epi32 ((int) colors[in[i + j]], (int) colors[in[i + j + 1]], (int) colors[in[i + j + 2]], (int) colors[in[i + j + 3]]));
+		}
+	}
+#endif
+	for (; i < count; i++)
+		out[i] = colors[in[i]];
+}
+
+void Screen::RedrawText () {
+	// Nothing was drawn before the texture existed, and the atlas reads cells back itself
+	if (this->ready && this->atlas == nullptr) {
+		std::lock_guard<std::mutex> guard (this->texture_lock);
+		for (int y = 0; y < rows; y++)
+			for (int x = 0; x < columns; x++)
+				this->draw_glyph (this->data[y * 160 + x * 2 + 1], x, y, this->data[y * 160 + x * 2]);
+	}
+	this->MarkAllDirty ();
+}
+
+void Screen::RenderCells () {
+	uint64_t bits[rows][2];
+	bool clear;
+	uint32_t color;
+	{
+		std::lock_guard<std::mutex> guard (this->clear_lock);
+		clear = this->clear_pending;
+		color = this->clear_color;
+		this->clear_pending = false;
+		for (int y = 0; y < rows; y++) {
+			bits[y][0] = this->dirty[y][0].exchange (0, std::memory_order_acquire);
+			bits[y][1] = this->dirty[y][1].exchange (0, std::memory_order_acquire);
+		}
+	}
+
+	if (clear)
+		this->atlas->Clear (color);
+
+	const uint32_t *colors = (uint32_t *) this->palette;
+	for (int y = 0; y < rows; y++) {
+		if ((bits[y][0] | bits[y][1]) == 0)
+			continue;
+		for (int x = 0; x < columns; x++)
+			if (bits[y][x >> 6] & (1ULL << (x & 63))) {
+				const uint8_t *cell = &this->data[y * 160 + x * 2];
+				this->atlas->Queue (x, y, cell[1], colors[cell[0] & 0x0F], colors[(cell[0] & 0xF0) >> 4]);
+			}
+	}
+
+	this->atlas->Flush ();
+}
+
+void Screen::writew (uint32_t absolute, uint32_t relative, uint8_t data) {
+	if (relative >= 0x400) {
+		while (!this->ready);
+		uint32_t pos = relative - 0x400;
+		this->data[pos] = data;
+		if (pos % 2 == 1) {
+			// The atlas reads the cell back from data when it redraws it, and
+			// RedrawText catches up on cells written during graphics mode
+			if (this->atlas == nullptr && this->mode == Text)
+				draw_glyph (data, (pos % 160) / 2, (pos / 160), this->data[pos - 1]);
+			this->MarkDirty ((pos % 160) / 2, pos / 160);
+		}
+	}
+	else {
+		// Tiles only use the first 16 entries; any change there makes every cached tile stale
+		if (palette[relative] != data) {
+			if (relative < 16 * 4)
+				this->palette_generation++;
+			if (this->mode == Graphics)
+				this->framebuffer->MarkAllDirty ();
+		}
+		palette[relative] = data;
+	}
+}
+void Screen::writed (uint32_t absolute, uint32_t relative, uint16_t data) {
+	this->writew (absolute, relative, (data & 0x00FF));
+	this->writew (absolute + 1, relative + 1, (data & 0xFF00) >> 8);
+}
+void Screen::writeq (uint32_t absolute, uint32_t relative, uint32_t data) {
+	this->writed (absolute, relative, (data & 0x0000FFFF));
+	this->writed (absolute + 2, relative + 2, (data & 0xFFFF0000) >> 16);
+}
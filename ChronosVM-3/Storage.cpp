@@ -1,54 +1,336 @@
-#include "Storage.h"
-
-#include <cstdio>
-
-#include <fstream>
-
-Storage::Storage (VirtualMachine *VM) :
-	Hardware (VM),
-	MemoryRegion (0x70000, 512) { 
-}
-
-Storage::~Storage () { 
-	free (this->memory);
-}
-
-void Storage::Start () {
-	this->memory = (uint8_t *) malloc (512 * 256 * 256);
-	memset (this->memory, 0x00, 512 * 256 * 256);
-	std::ifstream file ("data.img", std::ios::in | std::ios::binary);
-	if (file.is_open ()) {
-		file.rdbuf ()->sgetn ((char *) this->memory, 512 * 256 * 256);
-		file.close ();
-	}
-}
-
-void Storage::Stop () {
-	std::ofstream file ("data.img", std::ios::out | std::ios::binary | std::ios::trunc);
-	if (file.is_open ()) {
-		file.rdbuf ()->sputn ((char *) this->memory, 512 * 256 * 256);
-		file.close ();
-	}
-}
-
-void Storage::writew (uint32_t absolute, uint32_t relative, uint8_t data) {
-	this->memory[relative + (sector * 256) + (lane * 256 * 256)] = data;
-}
-void Storage::writed (uint32_t absolute, uint32_t relative, uint16_t data) {
-	this->writew (absolute + 0, relative + 0, (data & 0xFF00) >> 8);
-	this->writew (absolute + 1, relative + 1, (data & 0x00FF) >> 0);
-}
-void Storage::writeq (uint32_t absolute, uint32_t relative, uint32_t data) {
-	this->writed (absolute + 0, relative + 0, (data & 0xFFFF0000) >> 16);
-	this->writed (absolute + 2, relative + 2, (data & 0x0000FFFF) >> 00);
-}
-
-uint8_t Storage::readw (uint32_t absolute, uint32_t relative) {
-	return this->memory[relative + (sector * 256) + (lane * 256 * 256)];
-}
-uint16_t Storage::readd (uint32_t absolute, uint32_t relative) {
-	return (this->readw (absolute, relative) << 8) | this->readw (absolute + 1, relative + 1);
-}
-uint32_t Storage::readq (uint32_t absolute, uint32_t relative) {
-	return (this->readd (absolute, relative) << 16) | this->readd (absolute + 2, relative + 2);
-}
+#include "Storage.h"
+
+#include "Memory.h"
+#include "DiskImage.h"
+
+#include <string.h>
+
+Storage::Storage (VirtualMachine *VM, uint8_t line) :
+	Hardware (VM),
+	MemoryRegion (0x70000, sector_size),
+	line (line),
+	result (Ready),
+	in_flight (0),
+	flush_interval (1000) { 
+}
+
+Storage::~Storage () { 
+	{
+		std::lock_guard<std::mutex> guard (this->lock);
+		this->stopping = true;
+		this->pending.notify_all ();
+	}
+	{
+		std::lock_guard<std::mutex> guard (this->flush_lock);
+		this->flush_stop = true;
+		this->flush_wake.notify_all ();
+	}
+	for (std::thread *thread : this->threads) {
+		thread->join ();
+		delete thread;
+	}
+	if (this->flusher != nullptr) {
+		this->flusher->join ();
+		delete this->flusher;
+	}
+	delete this->disk;
+	delete[] this->dirty;
+}
+
+void Storage::SetDisk (Disk *disk) {
+	delete this->disk;
+	this->disk = disk;
+}
+
+// data.img is mapped rather than read; the guest faults in what it touches
+void Storage::Start () {
+	VirtualMachine *VM = Hardware::GetVM ();
+
+	if (this->disk == nullptr)
+		this->disk = new DiskImage ("data.img", image_size);
+	if (this->dirty == nullptr) {
+		this->dirty_words = (size_t) ((this->disk->GetSectors () + 63) / 64);
+		this->dirty = new std::atomic<uint64_t>[this->dirty_words];
+		for (size_t i = 0; i < this->dirty_words; i++)
+			this->dirty[i] = 0;
+	}
+	if (this->flusher == nullptr)
+		this->flusher = new std::thread (&Storage::Flusher, this);
+	for (size_t i = this->threads.size (); i < io_threads; i++)
+		this->threads.push_back (new std::thread (&Storage::Work, this));
+
+	VM->RequestPortInq<Storage, &Storage::SetLBA> (0x60, this);
+	VM->RequestPortInq<Storage, &Storage::SetCount> (0x61, this);
+	VM->RequestPortInq<Storage, &Storage::SetAddress> (0x62, this);
+	VM->RequestPortInb<Storage, &Storage::Command> (0x63, this);
+	VM->RequestPortInb<Storage, &Storage::SetLine> (0x64, this);
+
+	VM->RequestPortOutb<Storage, &Storage::Status> (0x63, this);
+}
+
+void Storage::Stop () {
+	{
+		std::unique_lock<std::mutex> guard (this->lock);
+		this->drained.wait (guard, [this] { return this->in_flight == 0; });
+	}
+	if (this->dirty != nullptr)
+		this->FlushDirty ();
+}
+
+void Storage::SetFlushInterval (std::chrono::milliseconds interval) {
+	std::lock_guard<std::mutex> guard (this->flush_lock);
+	this->flush_interval = interval;
+	this->flush_wake.notify_all ();
+}
+
+void Storage::SetLBA (uint32_t value) {
+	this->lba = value;
+}
+void Storage::SetCount (uint32_t value) {
+	this->count = value;
+}
+void Storage::SetAddress (uint32_t value) {
+	this->address = value;
+}
+void Storage::SetLine (uint8_t value) {
+	this->line = value;
+}
+
+void Storage::Command (uint8_t value) {
+	request r;
+	if (!this->Prepare (value, r)) {
+		this->Complete (Error);
+		return;
+	}
+
+	if (r.bytes == 0 || r.ram == nullptr) {
+		this->Complete (this->Bounce (r) ? Ready : Error);
+		return;
+	}
+
+	std::lock_guard<std::mutex> guard (this->lock);
+	if (this->in_flight >= queue_depth) {
+		this->Complete (Error | Full);
+		return;
+	}
+	this->queue.push_back (r);
+	this->in_flight++;
+	this->pending.notify_one ();
+}
+
+uint8_t Storage::Status () {
+	return this->result | (this->in_flight > 0 ? Busy : Ready);
+}
+
+bool Storage::Prepare (uint8_t command, request &r) {
+	if (command != Read && command != Write)
+		return false;
+
+	uint64_t length = (uint64_t) this->count * sector_size;
+	if (this->disk == nullptr || (uint64_t) this->lba + this->count > this->disk->GetSectors () || this->address + length > Memory::address_space)
+		return false;
+
+	Memory *memory = Hardware::GetVM ()->memory;
+	r.command = command;
+	r.lba = this->lba;
+	r.address = this->address;
+	r.bytes = (uint32_t) length;
+	r.ram = nullptr;
+
+	if (r.bytes == 0)
+		return true;
+
+	if (memory->IsRAM (r.address, r.bytes)) {
+		r.ram = memory->memory + r.address;
+		// Translated code over the buffer is dropped now, on the VM thread,
+		// rather than from the I/O thread that overwrites it
+		if (command == Read)
+			memory->Written (r.address, r.bytes);
+		return true;
+	}
+
+	// Bounced a byte at a time, which is only safe when every byte has a
+	// region behind it; anything else would land on unmapped memory
+	return memory->IsRegion (r.address, r.bytes);
+}
+
+// One memcpy per run of sectors the disk keeps together; a flat image is one run
+bool Storage::Copy (const request &r) {
+	uint8_t *ram = r.ram;
+	for (uint64_t lba = r.lba, left = r.bytes / sector_size; left > 0; ) {
+		uint64_t run = left;
+		uint8_t *sectors = this->disk->Map (lba, run, r.command == Write, true);
+		if (sectors == nullptr)
+			return false;
+
+		size_t bytes = (size_t) (run * sector_size);
+
+		if (r.command == Read)
+			memcpy (ram, sectors, bytes);
+		else {
+			memcpy (sectors, ram, bytes);
+			// Only once the data is there, or a flush in between would
+			// clear the bits and never write it back
+			this->MarkDirty (lba, run);
+		}
+		ram += bytes;
+		lba += run;
+		left -= run;
+	}
+	return true;
+}
+
+// A range inside a memory region (a framebuffer, say) goes through the memory map a byte at a time
+bool Storage::Bounce (const request &r) {
+	Memory *memory = Hardware::GetVM ()->memory;
+	uint32_t address = r.address;
+	for (uint64_t lba = r.lba, left = r.bytes / sector_size; left > 0; ) {
+		uint64_t run = left;
+		uint8_t *sectors = this->disk->Map (lba, run, r.command == Write, true);
+		if (sectors == nullptr)
+			return false;
+
+		for (uint64_t i = 0; i < run * sector_size; i++, address++)
+			if (r.command == Read)
+				memory->writew (address, sectors[i]);
+			else
+				sectors[i] = memory->readw (address);
+		if (r.command == Write)
+			this->MarkDirty (lba, run);
+		lba += run;
+		left -= run;
+	}
+	return true;
+}
+
+void Storage::Complete (uint8_t result) {
+	this->result = result;
+	Hardware::GetVM ()->interrupt (this->line);
+}
+
+// I/O thread: copies are where the mapped image faults pages in from disk
+void Storage::Work () {
+	std::unique_lock<std::mutex> guard (this->lock);
+	while (true) {
+		this->pending.wait (guard, [this] { return this->stopping || !this->queue.empty (); });
+		if (this->queue.empty ())
+			return;
+
+		request r = this->queue.front ();
+		this->queue.pop_front ();
+		guard.unlock ();
+
+		bool copied = this->Copy (r);
+
+		// Not busy any more by the time the guest takes the interrupt
+		guard.lock ();
+		if (--this->in_flight == 0)
+			this->drained.notify_all ();
+		guard.unlock ();
+
+		this->Complete (copied ? Ready : Error);
+		guard.lock ();
+	}
+}
+
+void Storage::MarkDirty (uint64_t first, uint64_t sectors) {
+	if (sectors == 0)
+		return;
+
+	uint64_t last = first + sectors - 1;
+	for (uint64_t word = first >> 6; word <= last >> 6; word++) {
+		uint32_t lo = word == first >> 6 ? first & 63 : 0;
+		uint32_t hi = word == last >> 6 ? last & 63 : 63;
+		uint64_t bits = (hi == 63 ? ~0ULL : (1ULL << (hi + 1)) - 1) & ~((1ULL << lo) - 1);
+		this->dirty[word].fetch_or (bits, std::memory_order_release);
+	}
+}
+
+void Storage::FlushDirty () {
+	uint64_t run_start = 0, run_length = 0;
+
+	for (size_t word = 0; word < this->dirty_words; word++) {
+		uint64_t bits = this->dirty[word].load (std::memory_order_relaxed) ? this->dirty[word].exchange (0, std::memory_order_acquire) : 0;
+
+		// Whole words extend or end a run without looking at each sector
+		if (bits == 0 || bits == ~0ULL) {
+			if (bits != 0) {
+				if (run_length == 0)
+					run_start = (uint64_t) word * 64;
+				run_length += 64;
+			} else if (run_length > 0) {
+				this->disk->Flush (run_start, run_length);
+				run_length = 0;
+			}
+			continue;
+		}
+
+		for (int bit = 0; bit < 64; bit++) {
+			uint64_t sector = (uint64_t) word * 64 + bit;
+			if (bits & (1ULL << bit)) {
+				if (run_length == 0)
+					run_start = sector;
+				run_length++;
+			} else if (run_length > 0) {
+				this->disk->Flush (run_start, run_length);
+				run_length = 0;
+			}
+		}
+	}
+
+	if (run_length > 0)
+		this->disk->Flush (run_start, run_length);
+}
+
+void Storage::Flusher () {
+	std::unique_lock<std::mutex> guard (this->flush_lock);
+	while (true) {
+		if (this->flush_interval.count () > 0)
+			this->flush_wake.wait_for (guard, this->flush_interval);
+		else
+			this->flush_wake.wait (guard);
+
+		if (this->flush_stop)
+			return;
+
+		guard.unlock ();
+		this->FlushDirty ();
+		guard.lock ();
+	}
+}
+
+uint8_t *Storage::At (uint32_t relative, bool write) {
+	uint64_t sectors = 1;
+	if (this->disk == nullptr || relative >= sector_size)
+		return nullptr;
+
+	// A single byte store keeps the rest of the sector
+	uint8_t *sector = this->disk->Map (this->lba, sectors, write, false);
+	return sector != nullptr ? sector + relative : nullptr;
+}
+
+void Storage::writew (uint32_t absolute, uint32_t relative, uint8_t data) {
+	if (uint8_t *byte = this->At (relative, true)) {
+		*byte = data;
+		this->MarkDirty (this->lba, 1);
+	}
+}
+void Storage::writed (uint32_t absolute, uint32_t relative, uint16_t data) {
+	this->writew (absolute + 0, relative + 0, (data & 0xFF00) >> 8);
+	this->writew (absolute + 1, relative + 1, (data & 0x00FF) >> 0);
+}
+void Storage::writeq (uint32_t absolute, uint32_t relative, uint32_t data) {
+	this->writed (absolute + 0, relative + 0, (data & 0xFFFF0000) >> 16);
+	this->writed (absolute + 2, relative + 2, (data & 0x0000FFFF) >> 00);
+}
+
+uint8_t Storage::readw (uint32_t absolute, uint32_t relative) {
+	uint8_t *byte = this->At (relative, false);
+	return byte != nullptr ? *byte : 0;
+}
+uint16_t Storage::readd (uint32_t absolute, uint32_t relative) {
+	return (this->readw (absolute, relative) << 8) | this->readw (absolute + 1, relative + 1);
+}
+uint32_t Storage::readq (uint32_t absolute, uint32_t relative) {
+	return (this->readd (absolute, relative) << 16) | this->readd (absolute + 2, relative + 2);
+}
@@ -1,29 +1,131 @@
-#pragma once
-
-#include "Hardware.h"
-#include "MemoryRegion.h"
-
-#include <stdlib.h>
-
-class Storage : public Hardware, public MemoryRegion {
-public:
-	Storage (VirtualMachine *VM);
-	~Storage ();
-
-	void Start ();
-	void Stop ();
-
-	void writew (uint32_t absolute, uint32_t relative, uint8_t data);
-	void writed (uint32_t absolute, uint32_t relative, uint16_t data);
-	void writeq (uint32_t absolute, uint32_t relative, uint32_t data);
-
-	uint8_t readw (uint32_t absolute, uint32_t relative);
-	uint16_t readd (uint32_t absolute, uint32_t relative);
-	uint32_t readq (uint32_t absolute, uint32_t relative);
-private:
-	uint8_t sector = 0;
-	uint8_t lane = 0;
-
-	uint8_t *memory;
-};
-
+#pragma once
+
+#include "Hardware.h"
+#include "MemoryRegion.h"
+#include "Disk.h"
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <vector>
+
+// The disk. The 512 byte window at 0x70000 shows the sector selected by the
+// LBA register; whole runs of sectors move to and from guest memory through
+// the block controller, one copy per command:
+//
+//   inq  $60  LBA of the first sector        inb  $63  command (see command)
+//   inq  $61  sector count                   inb  $64  completion interrupt line
+//   inq  $62  guest address                  outb $63  status (see status)
+//
+// Each command raises the completion line when it finishes, failed or not.
+// Transfers between the image and plain RAM run on I/O threads while the
+// guest keeps executing; up to queue_depth may be in flight, they complete
+// in any order, and the guest must leave the buffer alone until then.
+// Transfers into a memory region run synchronously on the VM thread; a range
+// that is neither all RAM nor inside one region fails with Error.
+//
+// Sectors written by the guest are tracked in a bitmap; a flusher thread
+// writes runs of dirty sectors back every flush interval, and Stop only
+// flushes what is still dirty.
+//
+// The disk is data.img mapped flat unless SetDisk supplies another, such as
+// an OverlayImage over a base shared with other machines.
+class Storage : public Hardware, public MemoryRegion {
+public:
+	enum command {
+		Read	= 0x01,	// image to guest memory
+		Write	= 0x02,	// guest memory to image
+	};
+	enum status {
+		Ready	= 0x00,
+		Busy	= 0x01,	// transfers are in flight
+		Error	= 0x02,	// the last command to finish failed: out of range, unknown, or refused by the disk
+		Full	= 0x04,	// with Error: the last command was refused because the queue was full
+	};
+
+	Storage (VirtualMachine *VM, uint8_t line = 33);
+	~Storage ();
+
+	void Start ();
+	void Stop ();
+
+	// Replaces the default flat data.img; Storage takes ownership. Call before Start.
+	void SetDisk (Disk *disk);
+
+	// How often dirty sectors are written back; zero leaves it to Stop
+	void SetFlushInterval (std::chrono::milliseconds interval);
+
+	void SetLBA (uint32_t value);
+	void SetCount (uint32_t value);
+	void SetAddress (uint32_t value);
+	void SetLine (uint8_t value);
+	void Command (uint8_t value);
+	uint8_t Status ();
+
+	void writew (uint32_t absolute, uint32_t relative, uint8_t data);
+	void writed (uint32_t absolute, uint32_t relative, uint16_t data);
+	void writeq (uint32_t absolute, uint32_t relative, uint32_t data);
+
+	uint8_t readw (uint32_t absolute, uint32_t relative);
+	uint16_t readd (uint32_t absolute, uint32_t relative);
+	uint32_t readq (uint32_t absolute, uint32_t relative);
+
+	static const uint64_t image_size = 512 * 256 * 256;
+	static const uint32_t sector_size = Disk::sector_size;
+	static const int queue_depth = 8;
+	static const int io_threads = 2;
+private:
+	// One validated transfer; ram is nullptr when the range is not plain RAM
+	struct request {
+		uint8_t command;
+		uint64_t lba;
+		uint8_t *ram;
+		uint32_t address;
+		uint32_t bytes;
+	};
+
+	// Where relative lands in the disk, or nullptr past its end
+	uint8_t *At (uint32_t relative, bool write);
+
+	bool Prepare (uint8_t command, request &r);
+	// False if the disk refused part of the range (a read-only disk, say)
+	bool Copy (const request &r);
+	bool Bounce (const request &r);
+	void Complete (uint8_t result);
+	void Work ();
+
+	void MarkDirty (uint64_t first, uint64_t sectors);
+	// Writes back the sectors dirty so far, coalescing adjacent ones
+	void FlushDirty ();
+	void Flusher ();
+
+	uint32_t lba = 0;
+	uint32_t count = 0;
+	uint32_t address = 0;
+	uint8_t line;
+	std::atomic<uint8_t> result;
+
+	Disk *disk = nullptr;
+
+	std::vector<std::thread *> threads;
+	std::deque<request> queue;
+	std::atomic<int> in_flight;
+	bool stopping = false;
+	std::mutex lock;
+	std::condition_variable pending;
+	std::condition_variable drained;
+
+	// One bit per sector of the disk
+	std::atomic<uint64_t> *dirty = nullptr;
+	size_t dirty_words = 0;
+
+	std::chrono::milliseconds flush_interval;
+	std::thread *flusher = nullptr;
+	bool flush_stop = false;
+	std::mutex flush_lock;
+	std::condition_variable flush_wake;
+};
+
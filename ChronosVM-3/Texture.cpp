@@ -1,27 +1,41 @@
-#include "Texture.h"
-
-
-
-Texture::Texture (SDL_Renderer *renderer, int width, int height) :
-	width (width),
-	height (height),
-	renderer (renderer) {
-	pixels = new uint32_t[this->GetSize ()];
-	SDL_memset4 (pixels, 0xFFFFFFFF, this->GetSize ());
-
-	this->texture = SDL_CreateTexture (this->renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, this->width, this->height);
-	this->Update ();
-}
-
-Texture::~Texture () {
-	delete[] this->pixels;
-	SDL_DestroyTexture (this->texture);
-}
-
-void Texture::Draw (SDL_Rect *dest, SDL_Rect *src) {
-	SDL_RenderCopy (this->renderer, this->texture, src, dest);
-}
-
-void Texture::Update (SDL_Rect *region) {
-	SDL_UpdateTexture (this->texture, region, this->pixels, this->width * sizeof (uint32_t));
-}
+#include "Texture.h"
+
+
+
+Texture::Texture (SDL_Renderer *renderer, int width, int height) :
+	width (width),
+	height (height),
+	renderer (renderer) {
+	pixels = new uint32_t[this->GetSize ()];
+	SDL_memset4 (pixels, 0xFFFFFFFF, this->GetSize ());
+
+	this->texture = nullptr;
+	if (this->renderer == nullptr)
+		return;
+
+	this->texture = SDL_CreateTexture (this->renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, this->width, this->height);
+	this->Update ();
+}
+
+Texture::~Texture () {
+	delete[] this->pixels;
+	if (this->texture != nullptr)
+		SDL_DestroyTexture (this->texture);
+}
+
+void Texture::Draw (SDL_Rect *dest, SDL_Rect *src) {
+	if (this->texture == nullptr)
+		return;
+	SDL_RenderCopy (this->renderer, this->texture, src, dest);
+}
+
+void Texture::Update (SDL_Rect *region) {
+	if (this->texture == nullptr)
+		return;
+
+	// SDL expects the pixels of region itself, not of the whole buffer
+	uint32_t *source = this->pixels;
+	if (region != NULL)
+		source += region->y * this->width + region->x;
+	SDL_UpdateTexture (this->texture, region, source, this->width * sizeof (uint32_t));
+}
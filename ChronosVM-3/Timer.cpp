@@ -1,41 +1,84 @@
-#include "Timer.h"
-
-Timer::Timer (double update_rate) :
-	update_rate (update_rate) {
-	this->ticks_per_cycle = clock::period::den / this->update_rate;
-}
-
-
-Timer::~Timer () {
-	delete thread;
-}
-
-void Timer::Start () {
-	this->thread = new std::thread (&Timer::Loop, this);
-}
-
-void Timer::Loop () {
-	if (this->detached)
-		this->thread->detach ();
-	while (true) {
-		std::lock_guard<std::mutex> (this->lock);
-
-		if (!halted) {
-			long long elapsed = this->Elapsed ().count ();
-
-			if (elapsed > ticks_per_cycle) {
-				this->until_sec += elapsed;
-				this->elapsed_ticks++;
-
-				if (this->Tick != nullptr)
-					this->Tick (elapsed, this->elapsed_ticks);
-
-				this->Reset ();
-			}
-		}
-
-		if (stop)
-			if (this->detached) exit (0);
-			else if (this->thread->joinable ()) this->thread->join ();
-	}
-}
+#include "Timer.h"
+
+Timer::Timer (double update_rate) :
+	update_rate (update_rate),
+	halted (false),
+	stop (false) {
+	this->period = nanoseconds ((long long) (1e9 / this->update_rate));
+	if (this->period.count () == 0)
+		this->period = nanoseconds (1);
+}
+
+
+Timer::~Timer () {
+	this->Stop ();
+	delete thread;
+}
+
+void Timer::Start () {
+	this->thread = new std::thread (&Timer::Loop, this);
+}
+
+void Timer::Resume () {
+	std::lock_guard<std::mutex> guard (this->lock);
+	this->halted = false;
+	this->wake.notify_all ();
+}
+
+void Timer::Stop () {
+	{
+		std::lock_guard<std::mutex> guard (this->lock);
+		this->stop = true;
+		this->wake.notify_all ();
+	}
+
+	if (this->thread != nullptr && this->thread->joinable () && this->thread->get_id () != std::this_thread::get_id ())
+		this->thread->join ();
+}
+
+void Timer::Loop () {
+	if (this->detached)
+		this->thread->detach ();
+
+	std::unique_lock<std::mutex> guard (this->lock);
+	this->Reset ();
+	this->deadline = this->start + this->period;
+
+	while (!this->stop) {
+		if (this->halted) {
+			this->wake.wait (guard, [this] { return !this->halted || this->stop; });
+			// Ticks that would have fired while halted are not replayed
+			this->Reset ();
+			this->deadline = this->start + this->period;
+			continue;
+		}
+
+		if (this->wake.wait_until (guard, this->deadline, [this] { return this->halted || this->stop; }))
+			continue;
+
+		clock::time_point now = clock::now ();
+		if (now - this->deadline > std::chrono::milliseconds (max_lag_ms))
+			this->deadline = now;
+
+		guard.unlock ();
+		while (this->deadline <= now && !this->halted && !this->stop) {
+			this->elapsed_ticks++;
+			this->until_sec += this->period;
+
+			if (this->Tick != nullptr)
+				this->Tick (this->period.count (), this->elapsed_ticks);
+
+			if (this->until_sec >= std::chrono::seconds (1)) {
+				if (this->Second != nullptr)
+					this->Second (this->until_sec.count (), this->elapsed_ticks);
+				this->until_sec = nanoseconds (0);
+			}
+
+			this->deadline += this->period;
+		}
+		guard.lock ();
+	}
+
+	if (this->detached)
+		exit (0);
+}
@@ -1,43 +1,55 @@
-#pragma once
-
-#include <chrono>
-#include <thread>
-#include <mutex>
-
-class Timer {
-	typedef std::chrono::high_resolution_clock clock;
-	typedef std::chrono::nanoseconds nanoseconds;
-
-	typedef std::function<void (uint64_t delta, uint64_t total)> callback;
-public:
-	Timer (double update_rate);
-	~Timer ();
-
-	inline void Reset () { this->start = clock::now (); }
-	nanoseconds Elapsed () const { return std::chrono::duration_cast<nanoseconds> (clock::now () - this->start); }
-
-	inline void Halt () { this->halted = true; }
-	inline void Stop () { this->stop = true; }
-	inline void Detach () { this->detached = true; }
-
-	void Start ();
-	void Loop ();
-
-	callback Tick = nullptr;
-	callback Second = nullptr;
-private:
-	clock::time_point start;
-
-	double update_rate;
-	double ticks_per_cycle;
-
-	double elapsed_ticks = 0;
-	double until_sec = 0;
-	bool halted = false;
-
-	bool stop = false;
-	bool detached = false;
-
-	std::thread *thread;
-	std::mutex lock;
-};
+#pragma once
+
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+
+// Calls Tick update_rate times per second. The thread sleeps until the next
+// deadline and then runs every tick that has come due, so it does not spin
+// between ticks. While halted it blocks until Resume or Stop.
+class Timer {
+	typedef std::chrono::high_resolution_clock clock;
+	typedef std::chrono::nanoseconds nanoseconds;
+
+	typedef std::function<void (uint64_t delta, uint64_t total)> callback;
+public:
+	Timer (double update_rate);
+	~Timer ();
+
+	inline void Reset () { this->start = clock::now (); }
+	nanoseconds Elapsed () const { return std::chrono::duration_cast<nanoseconds> (clock::now () - this->start); }
+
+	inline void Halt () { this->halted = true; }
+	void Resume ();
+	void Stop ();
+	inline void Detach () { this->detached = true; }
+
+	void Start ();
+	void Loop ();
+
+	callback Tick = nullptr;
+	callback Second = nullptr;
+
+	// Ticks further behind than this are dropped instead of replayed
+	static const int max_lag_ms = 100;
+private:
+	clock::time_point start;
+	clock::time_point deadline;
+	nanoseconds period;
+
+	double update_rate;
+
+	uint64_t elapsed_ticks = 0;
+	nanoseconds until_sec = nanoseconds (0);
+	std::atomic<bool> halted;
+
+	std::atomic<bool> stop;
+	bool detached = false;
+
+	std::thread *thread = nullptr;
+	std::mutex lock;
+	std::condition_variable wake;
+};
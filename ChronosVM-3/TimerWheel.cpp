@@ -0,0 +1,127 @@
+#include "TimerWheel.h"
+
+TimerWheel::TimerWheel () {
+	this->start = clock::now ();
+	this->thread = new std::thread (&TimerWheel::Loop, this);
+}
+
+TimerWheel::~TimerWheel () {
+	{
+		std::lock_guard<std::mutex> guard (this->lock);
+		this->stop = true;
+		this->wake.notify_all ();
+	}
+	this->thread->join ();
+	delete this->thread;
+}
+
+TimerWheel &TimerWheel::Shared () {
+	static TimerWheel wheel;
+	return wheel;
+}
+
+TimerWheel::handle TimerWheel::Schedule (std::chrono::nanoseconds period, callback func, bool periodic) {
+	const long long tick_ns = resolution_us * 1000LL;
+	uint64_t ticks = (uint64_t) ((period.count () + tick_ns / 2) / tick_ns);
+	if (ticks == 0)
+		ticks = 1;
+
+	std::lock_guard<std::mutex> guard (this->lock);
+	// The wheel stops turning while nothing is armed; catch it up first
+	if (this->armed == 0)
+		this->current = this->Now ();
+
+	entry e;
+	e.id = this->next_id++;
+	e.deadline = this->current + ticks;
+	e.period = ticks;
+	e.periodic = periodic;
+	e.func = func;
+	this->Insert (e);
+
+	this->wake.notify_all ();
+	return e.id;
+}
+
+void TimerWheel::Cancel (handle timer) {
+	{
+		std::lock_guard<std::mutex> guard (this->lock);
+		for (auto &slot : this->slots)
+			for (size_t i = 0; i < slot.size (); i++)
+				if (slot[i].id == timer) {
+					slot.erase (slot.begin () + i);
+					this->armed--;
+				}
+	}
+
+	// It may be firing right now; wait for the batch to finish. This is why
+	// callbacks must not cancel timers themselves.
+	std::lock_guard<std::mutex> guard (this->fire_lock);
+}
+
+uint64_t TimerWheel::Now () const {
+	return (uint64_t) (std::chrono::duration_cast<std::chrono::microseconds> (clock::now () - this->start).count () / resolution_us);
+}
+
+void TimerWheel::Insert (const entry &e) {
+	this->slots[e.deadline % wheel_size].push_back (e);
+	this->armed++;
+}
+
+void TimerWheel::Loop () {
+	std::unique_lock<std::mutex> guard (this->lock);
+	std::vector<entry> due;
+
+	while (!this->stop) {
+		if (this->armed == 0) {
+			this->wake.wait (guard);
+			continue;
+		}
+
+		// Sleep until the next bucket that holds anything; a Schedule for an
+		// earlier tick wakes us to recompute
+		uint64_t target = this->current + 1;
+		for (int i = 1; i <= wheel_size; i++)
+			if (!this->slots[(this->current + i) % wheel_size].empty ()) {
+				target = this->current + i;
+				break;
+			}
+
+		clock::time_point when = this->start + std::chrono::microseconds (target * resolution_us);
+		if (this->wake.wait_until (guard, when) != std::cv_status::timeout && clock::now () < when)
+			continue;
+
+		uint64_t now = this->Now ();
+		for (; this->current < now; this->current++) {
+			std::vector<entry> &slot = this->slots[(this->current + 1) % wheel_size];
+			for (size_t i = 0; i < slot.size (); ) {
+				if (slot[i].deadline <= this->current + 1) {
+					due.push_back (slot[i]);
+					slot.erase (slot.begin () + i);
+					this->armed--;
+				} else
+					i++;
+			}
+		}
+
+		if (due.empty ())
+			continue;
+
+		// Periodic timers are re-armed before firing so Cancel can find them
+		for (entry &e : due)
+			if (e.periodic) {
+				entry next = e;
+				next.deadline = e.deadline + e.period;
+				if (next.deadline <= this->current)
+					next.deadline = this->current + 1;
+				this->Insert (next);
+			}
+
+		std::lock_guard<std::mutex> firing (this->fire_lock);
+		guard.unlock ();
+		for (entry &e : due)
+			e.func ();
+		due.clear ();
+		guard.lock ();
+	}
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stdint.h>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+
+#include "Delegate.h"
+
+// A hashed timing wheel shared by every device in the process. Timers are
+// bucketed by the tick they expire on; the wheel thread sleeps until the
+// next bucket that holds a timer and blocks outright when none are armed.
+class TimerWheel {
+	typedef std::chrono::steady_clock clock;
+public:
+	typedef Delegate<void ()> callback;
+	typedef uint32_t handle;
+
+	TimerWheel ();
+	~TimerWheel ();
+
+	static TimerWheel &Shared ();
+
+	// Calls func after period, and every period after that if periodic.
+	// Periods are rounded to the nearest tick of resolution_us, minimum one.
+	handle Schedule (std::chrono::nanoseconds period, callback func, bool periodic);
+	// Once Cancel returns the callback is not running and will not run again.
+	// Must not be called from inside a callback.
+	void Cancel (handle timer);
+
+	static const int wheel_size = 256;
+	static const int resolution_us = 500;
+private:
+	struct entry {
+		handle id;
+		uint64_t deadline;
+		uint64_t period;
+		bool periodic;
+		callback func;
+	};
+
+	void Loop ();
+	uint64_t Now () const;
+	void Insert (const entry &e);
+
+	std::vector<entry> slots[wheel_size];
+	uint64_t current = 0;
+	size_t armed = 0;
+	handle next_id = 1;
+	bool stop = false;
+
+	clock::time_point start;
+	std::thread *thread;
+	std::mutex lock;
+	std::mutex fire_lock;
+	std::condition_variable wake;
+};
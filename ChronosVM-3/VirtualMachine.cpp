@@ -1,1791 +1,2167 @@
-#include "VirtualMachine.h"
-
-#include "Hardware.h"
-
-#include <fstream>
-
-std::map<uint8_t, std::function<void (uint8_t)>> VirtualMachine::inpb;
-std::map<uint8_t, std::function<void (uint16_t)>> VirtualMachine::inpd;
-std::map<uint8_t, std::function<void (uint32_t)>> VirtualMachine::inpq;
-
-std::map<uint8_t, std::function<uint8_t ()>> VirtualMachine::outpb;
-std::map<uint8_t, std::function<uint16_t ()>> VirtualMachine::outpd;
-std::map<uint8_t, std::function<uint32_t ()>> VirtualMachine::outpq;
-
-#define has_in(port, t) this->inp##t##.count (port) > 0
-#define inp(port, t, val) (this->inp##t##.at (port)) (val)
-
-#define has_out(port, t) this->outp##t##.count (port) > 0
-#define outp(port, t) (this->outp##t##.at (port)) ()
-
-uint32_t colors[] {
-	0xff1d1f21,
-	0xff5f819d,
-	0xff8c9440,
-	0xff5e8d87,
-	0xffa54242,
-	0xff85678f,
-	0xffde935f,
-	0xff707880,
-	0xff81a2be,
-	0xffb5bd68,
-	0xff8abeb7,
-	0xffcc6666,
-	0xffb294bb,
-	0xfff0c674,
-	0xffc5c8c6,
-};
-
-VirtualMachine::VirtualMachine (uint32_t memorySize) {
-	this->memory = new Memory (memorySize);
-	this->registers = new struct registers ();
-
-	memset (this->memory->memory, 0, memorySize);
-	memset (this->registers, 0, sizeof (struct registers));
-	
-	for (int i = 0; i < 256; i++)
-		this->instructions[i] = &VirtualMachine::unimplemented_instruction;
-
-	this->instructions[nop] = &VirtualMachine::NOP;
-	this->instructions[mov] = &VirtualMachine::MOV;
-	this->instructions[cmp] = &VirtualMachine::CMP;
-	this->instructions[jmp] = &VirtualMachine::JMP;
-	this->instructions[je] = &VirtualMachine::JE;
-	this->instructions[jne] = &VirtualMachine::JNE;
-	this->instructions[jl] = &VirtualMachine::JL;
-	this->instructions[call] = &VirtualMachine::CALL;
-	this->instructions[calle] = &VirtualMachine::CALLE;
-	this->instructions[ret] = &VirtualMachine::RET;
-	this->instructions[iret] = &VirtualMachine::IRET;
-	this->instructions[sti] = &VirtualMachine::STI;
-	this->instructions[cli] = &VirtualMachine::CLI;
-	this->instructions[inc] = &VirtualMachine::INC;
-	this->instructions[add] = &VirtualMachine::ADD;
-	this->instructions[mul] = &VirtualMachine::MUL;
-	this->instructions[or] = &VirtualMachine::OR;
-	this->instructions[xor] = &VirtualMachine::XOR;
-	this->instructions[shl] = &VirtualMachine::SHL;
-	this->instructions[inb] = &VirtualMachine::INB;
-	this->instructions[outb] = &VirtualMachine::OUTB;
-	this->instructions[ldidt] = &VirtualMachine::LDIDT;
-	this->instructions[hlt] = &VirtualMachine::HLT;
-}
-
-VirtualMachine::~VirtualMachine () {
-	delete memory;
-}
-
-void VirtualMachine::unimplemented_instruction () {
-	printf ("Opcode: $%02X not implemented", this->memory->readw(this->registers->PC - 1));
-	this->status = Halted | Fault;
-}
-
-void VirtualMachine::NOP () {
-	printf ("nop");
-}
-
-void VirtualMachine::OUTB () {
-	addressing_mode mode = (addressing_mode) this->memory->readw (this->registers->PC++);
-
-	switch (mode) {
-		case VirtualMachine::RegisterImmediate:
-		{
-			uint8_t reg = this->memory->readw (this->registers->PC++);
-			uint8_t port = this->memory->readw (this->registers->PC++);
-
-			printf ("inb %s, $%02X", reg_name (reg), port);
-
-			this->set_reg (reg, this->moutb (port));
-			break;
-		}
-		default:
-			printf ("outb %s unimplemented", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-	}
-}
-
-void VirtualMachine::INB () {
-	addressing_mode mode = (addressing_mode) this->memory->readw (this->registers->PC++);
-
-	switch (mode) {
-		case VirtualMachine::ImmediateImmediate:
-		{
-			uint8_t port = this->memory->readw (this->registers->PC++);
-			uint8_t val = this->memory->readw (this->registers->PC++);
-
-			printf ("inb $%02X, $%02X", port, val);
-
-			this->minb (port, val);
-			break;
-		}
-		case VirtualMachine::ImmediateRegister:
-		{
-			uint8_t port = this->memory->readw (this->registers->PC++);
-			uint8_t reg = this->memory->readw (this->registers->PC++);
-			uint8_t val = this->read_reg (reg);
-
-			printf ("inb $%02X, %s($%02X)", port, this->reg_name (reg), val);
-
-			this->minb (port, val);
-			break;
-		}
-		case VirtualMachine::ImmediateIndirect:
-		{
-			uint8_t port = this->memory->readw (this->registers->PC++);
-			uint32_t addr = this->memory->readq (this->registers->PC);
-			this->registers->PC += 4;
-			uint8_t val = this->memory->readw (addr);
-
-			printf ("inb $%02x, ($%02x)", port, val);
-
-			this->minb (port, val);
-			break;
-		}
-		default:
-			printf ("inb %s unimplemented", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-	}
-}
-
-void VirtualMachine::MOV () {
-	addressing_mode mode = (addressing_mode) this->memory->readw (this->registers->PC++);
-
-	switch (mode) {
-		case VirtualMachine::Immediate:
-		case VirtualMachine::Register:
-		case VirtualMachine::Indirect:
-		case VirtualMachine::RIndirect:
-			printf ("mov %s impossible", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-		case VirtualMachine::RegisterImmediate:
-		{
-			size sz = (size) this->memory->readw (this->registers->PC++);
-			uint8_t reg = this->memory->readw (this->registers->PC++);
-			printf ("mov %s, ", reg_name (reg));
-			uint32_t val = read_val (sz);
-
-			set_reg (reg, val);
-
-			break;
-		}
-		case VirtualMachine::RegisterRindirect:
-		{
-			size sz = (size) this->memory->readw (this->registers->PC++);
-			uint8_t reg = this->memory->readw (this->registers->PC++);
-			printf ("mov %s", reg_name (reg));
-			printf (", ");
-			uint8_t reg2 = this->memory->readw (this->registers->PC++);
-			uint32_t reg_val = read_reg_ind (sz, reg2);
-			set_reg (reg, reg_val);
-			break;
-		}
-		case VirtualMachine::RIndirectRegister:
-		{
-			size sz = (size) this->memory->readw (this->registers->PC++);
-			uint8_t reg = this->memory->readw (this->registers->PC++);
-			uint8_t rval = this->memory->readw (this->registers->PC++);
-			printf ("mov ");
-			write_reg_ind (sz, reg, rval);
-			break;
-		}
-		case VirtualMachine::RIndirectImmediate:
-		{
-			size sz = (size) this->memory->readw (this->registers->PC++);
-			uint8_t reg = this->memory->readw (this->registers->PC++);
-			printf ("mov ");
-			write_reg_rind_val (sz, reg);
-
-			break;
-		}
-		case VirtualMachine::RIndirectIndirect:
-		{
-			size sz = (size) this->memory->readw (this->registers->PC++);
-			uint8_t reg = this->memory->readw (this->registers->PC++);
-			uint32_t addr = this->memory->readq (this->registers->PC);
-			this->registers->PC += 4;
-			printf ("mov ");
-			write_reg_rind_val_ind (sz, reg, addr);
-
-			break;
-		}
-		case VirtualMachine::IndirectRegister:
-		{
-			size sz = (size) this->memory->readw (this->registers->PC++);
-			uint32_t addr = this->memory->readq (this->registers->PC);
-			this->registers->PC += 4;
-			uint8_t reg = this->memory->readw (this->registers->PC++);
-
-			printf ("mov ");
-			write_reg (sz, addr, reg);
-
-			break;
-		}
-		case VirtualMachine::IndirectImmediate:
-		{
-			size sz = (size) this->memory->readw (this->registers->PC++);
-			uint32_t addr = this->memory->readq (this->registers->PC);
-			this->registers->PC += 4;
-			printf ("mov ");
-			write_val (sz, addr);
-
-			break;
-		}
-		case VirtualMachine::RegisterRegister:
-		{
-			size sz = (size) this->memory->readw (this->registers->PC++);
-			uint8_t reg = this->memory->readw (this->registers->PC++);
-			uint8_t reg2 = this->memory->readw (this->registers->PC++);
-			
-			printf ("mov ");
-			this->set_reg_reg (sz, reg, reg2);
-			break;
-		}
-		default:
-			printf ("mov %s unimplemented", addressing_name(mode));
-			this->status = Halted | Fault;
-			break;
-	}
-}
-
-void VirtualMachine::HLT () {
-	printf ("hlt");
-	this->status |= Halted;
-}
-
-void VirtualMachine::CMP () {
-	addressing_mode mode = (addressing_mode) this->memory->readw (this->registers->PC++);
-
-	set_reg (Flags, 0);
-
-	switch (mode) {
-		case VirtualMachine::Immediate:
-		case VirtualMachine::Register:
-		case VirtualMachine::Indirect:
-		case VirtualMachine::RIndirect:
-			printf ("cmp %s impossible", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-		case VirtualMachine::RegisterImmediate:
-		{
-			size sz = (size) this->memory->readw (this->registers->PC++);
-			uint8_t reg = this->memory->readw (this->registers->PC++);
-			uint32_t reg_val = read_reg (reg);
-			printf ("cmp %s, ", reg_name (reg));
-			uint32_t val = read_val (sz);
-
-			int64_t reg_v = (int64_t) reg_val;
-			int64_t val_v = (int64_t) val;
-
-			if (reg_v - val_v == 0)
-				this->registers->Flags |= Zero;
-			if (reg_v - val_v < 0)
-				this->registers->Flags |= Underflow;
-			if (reg_v - val_v > UINT32_MAX)
-				this->registers->Flags |= Overflow;
-			if ((reg_v - val_v) % 2 == 0)
-				this->registers->Flags |= Parity;
-
-			break;
-		}
-		case VirtualMachine::RIndirectImmediate:
-		{
-			size sz = (size) this->memory->readw (this->registers->PC++);
-			uint8_t reg = this->memory->readw (this->registers->PC++);
-			printf ("cmp ", reg_name (reg));
-			uint32_t reg_val = read_reg_ind(sz, reg);
-			printf (", ");
-			uint32_t val = read_val (sz);
-
-			int64_t reg_v = (int64_t) reg_val;
-			int64_t val_v = (int64_t) val;
-
-			if (reg_v - val_v == 0)
-				this->registers->Flags |= Zero;
-			if (reg_v - val_v < 0)
-				this->registers->Flags |= Underflow;
-			if (reg_v - val_v > UINT32_MAX)
-				this->registers->Flags |= Overflow;
-			if ((reg_v - val_v) % 2 == 0)
-				this->registers->Flags |= Parity;
-
-			break;
-		}
-		case VirtualMachine::IndirectImmediate:
-		{
-			size sz = (size) this->memory->readw (this->registers->PC++);
-			printf ("cmp (");
-			uint32_t addr_a = read_val (qword);
-			printf ("), ");
-			uint32_t b = read_val (sz);
-			uint32_t a = this->read_val_n (sz, addr_a);
-
-			int64_t val_a = (int64_t) a;
-			int64_t val_b = (int64_t) b;
-
-			if (val_a - val_b == 0)
-				this->registers->Flags |= Zero;
-			if (val_a - val_b < 0)
-				this->registers->Flags |= Underflow;
-			if (val_a - val_b > UINT32_MAX)
-				this->registers->Flags |= Overflow;
-			if ((val_a - val_b) % 2 == 0)
-				this->registers->Flags |= Parity;
-
-			break;
-		}
-		default:
-			printf ("cmp %s unimplemented", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-	}
-}
-
-void VirtualMachine::JMP () {
-	addressing_mode mode = (addressing_mode) this->memory->readw (this->registers->PC++);
-
-	switch (mode) {
-		case VirtualMachine::Immediate:
-		{
-			uint32_t val = this->memory->readq (this->registers->PC);
-			this->registers->PC = val;
-			printf ("jmp $%08X", val);
-			break;
-		}
-		case VirtualMachine::Register:
-			printf ("jmp %s unimplemented", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-		case VirtualMachine::Indirect:
-			printf ("jmp %s unimplemented", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-		case VirtualMachine::RIndirect:
-			printf ("jmp %s unimplemented", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-		default:
-			printf ("jmp %s impossible", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-	}
-}
-
-void VirtualMachine::JE () {
-	addressing_mode mode = (addressing_mode) this->memory->readw (this->registers->PC++);
-
-	switch (mode) {
-		case VirtualMachine::Immediate:
-		{
-			uint32_t val = this->memory->readq (this->registers->PC);
-			if (this->registers->Flags & Zero)
-				this->registers->PC = val;
-			else
-				this->registers->PC += 4;
-			printf ("je $%08X", val);
-			break;
-		}
-		case VirtualMachine::Register:
-			printf ("je %s unimplemented", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-		case VirtualMachine::Indirect:
-			printf ("je %s unimplemented", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-		case VirtualMachine::RIndirect:
-			printf ("je %s unimplemented", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-		default:
-			printf ("je %s impossible", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-	}
-}
-
-void VirtualMachine::JL () {
-	addressing_mode mode = (addressing_mode) this->memory->readw (this->registers->PC++);
-
-	switch (mode) {
-		case VirtualMachine::Immediate:
-		{
-			uint32_t val = this->memory->readq (this->registers->PC);
-			if (this->registers->Flags & Underflow)
-				this->registers->PC = val;
-			else
-				this->registers->PC += 4;
-			printf ("jl $%08X", val);
-			break;
-		}
-		case VirtualMachine::Register:
-			printf ("jl %s unimplemented", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-		case VirtualMachine::Indirect:
-			printf ("jl %s unimplemented", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-		case VirtualMachine::RIndirect:
-			printf ("jl %s unimplemented", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-		default:
-			printf ("jl %s impossible", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-	}
-}
-
-void VirtualMachine::JNE () {
-	addressing_mode mode = (addressing_mode) this->memory->readw (this->registers->PC++);
-
-	switch (mode) {
-		case VirtualMachine::Immediate:
-		{
-			uint32_t val = this->memory->readq (this->registers->PC);
-			if (!(this->registers->Flags & Zero))
-				this->registers->PC = val;
-			else
-				this->registers->PC += 4;
-			printf ("jne $%08X", val);
-			break;
-		}
-		case VirtualMachine::Register:
-			printf ("jne %s unimplemented", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-		case VirtualMachine::Indirect:
-			printf ("jne %s unimplemented", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-		case VirtualMachine::RIndirect:
-			printf ("jne %s unimplemented", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-		default:
-			printf ("jne %s impossible", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-	}
-}
-
-void VirtualMachine::XOR () {
-	addressing_mode mode = (addressing_mode) this->memory->readw (this->registers->PC++);
-
-	switch (mode) {
-		case VirtualMachine::Register:
-		{
-			uint8_t reg = this->memory->readw (this->registers->PC++);
-			printf ("xor %s", reg_name(reg));
-			set_reg (reg, 0);
-			break;
-		}
-		case VirtualMachine::RegisterImmediate:
-		case VirtualMachine::RegisterRegister:
-		case VirtualMachine::RegisterIndirect:
-		case VirtualMachine::RegisterRindirect:
-		case VirtualMachine::IndirectImmediate:
-		case VirtualMachine::IndirectRegister:
-		case VirtualMachine::IndirectIndirect:
-		case VirtualMachine::IndirectRIndirect:
-		case VirtualMachine::RIndirectImmediate:
-		case VirtualMachine::RIndirectRegister:
-		case VirtualMachine::RIndirectIndirect:
-		case VirtualMachine::RIndirectRIndirect:
-		case VirtualMachine::Indirect:
-		case VirtualMachine::RIndirect:
-			printf ("xor %s unimplemented", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-		default:
-			printf ("xor %s impossible", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-	}
-}
-
-void VirtualMachine::OR () {
-	addressing_mode mode = (addressing_mode) this->memory->readw (this->registers->PC++);
-
-	switch (mode) {
-		case VirtualMachine::RegisterImmediate:
-		{
-			size sz = (size) this->memory->readw (this->registers->PC++);
-			uint8_t reg = this->memory->readw (this->registers->PC++);
-			uint32_t reg_val = read_reg (reg);
-			printf ("or %s, ", reg_name (reg));
-			uint32_t val = read_val (sz);
-
-			set_reg (reg, reg_val | val);
-
-			break;
-		}
-		case VirtualMachine::RegisterRegister:
-		case VirtualMachine::RegisterIndirect:
-		case VirtualMachine::RegisterRindirect:
-		case VirtualMachine::IndirectImmediate:
-		case VirtualMachine::IndirectRegister:
-		case VirtualMachine::IndirectIndirect:
-		case VirtualMachine::IndirectRIndirect:
-		case VirtualMachine::RIndirectImmediate:
-		case VirtualMachine::RIndirectRegister:
-		case VirtualMachine::RIndirectIndirect:
-		case VirtualMachine::RIndirectRIndirect:
-			printf ("or %s unimplemented", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-		default:
-			printf ("or %s impossible", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-	}
-}
-
-void VirtualMachine::INC () {
-	addressing_mode mode = (addressing_mode) this->memory->readw (this->registers->PC++);
-
-	switch (mode) {
-		case VirtualMachine::Register:
-		{
-			uint8_t reg = this->memory->readw (this->registers->PC++);
-			uint32_t reg_val = read_reg (reg);
-			printf ("inc %s", reg_name (reg));
-			set_reg (reg, reg_val + 1);
-			break;
-		}
-		case VirtualMachine::RegisterImmediate:
-		case VirtualMachine::RegisterRegister:
-		case VirtualMachine::RegisterIndirect:
-		case VirtualMachine::RegisterRindirect:
-		case VirtualMachine::IndirectImmediate:
-		case VirtualMachine::IndirectRegister:
-		case VirtualMachine::IndirectIndirect:
-		case VirtualMachine::IndirectRIndirect:
-		case VirtualMachine::RIndirectImmediate:
-		case VirtualMachine::RIndirectRegister:
-		case VirtualMachine::RIndirectIndirect:
-		case VirtualMachine::RIndirectRIndirect:
-		case VirtualMachine::Indirect:
-		case VirtualMachine::RIndirect:
-			printf ("inc %s unimplemented", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-		default:
-			printf ("inc %s impossible", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-	}
-}
-
-void VirtualMachine::SHL () {
-	addressing_mode mode = (addressing_mode) this->memory->readw (this->registers->PC++);
-
-	switch (mode) {
-		case VirtualMachine::RegisterImmediate:
-		{
-			uint8_t reg = this->memory->readw (this->registers->PC++);
-			uint32_t reg_val = read_reg (reg);
-			printf ("shl %s, ", reg_name (reg));
-			uint32_t amm = this->memory->readw (this->registers->PC++);
-
-			set_reg (reg, reg_val << amm);
-
-			break;
-		}
-		case VirtualMachine::RegisterRegister:
-		case VirtualMachine::RegisterIndirect:
-		case VirtualMachine::RegisterRindirect:
-		case VirtualMachine::IndirectImmediate:
-		case VirtualMachine::IndirectRegister:
-		case VirtualMachine::IndirectIndirect:
-		case VirtualMachine::IndirectRIndirect:
-		case VirtualMachine::RIndirectImmediate:
-		case VirtualMachine::RIndirectRegister:
-		case VirtualMachine::RIndirectIndirect:
-		case VirtualMachine::RIndirectRIndirect:
-			printf ("shl %s unimplemented", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-		default:
-			printf ("shl %s impossible", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-	}
-}
-
-void VirtualMachine::CALL () {
-	addressing_mode mode = (addressing_mode) this->memory->readw (this->registers->PC++);
-
-	switch (mode) {
-		case VirtualMachine::ImmediateImmediate:
-		case VirtualMachine::ImmediateRegister:
-		case VirtualMachine::ImmediateIndirect:
-		case VirtualMachine::ImmediateRindirect:
-		case VirtualMachine::RegisterImmediate:
-		case VirtualMachine::RegisterRegister:
-		case VirtualMachine::RegisterIndirect:
-		case VirtualMachine::RegisterRindirect:
-		case VirtualMachine::IndirectImmediate:
-		case VirtualMachine::IndirectRegister:
-		case VirtualMachine::IndirectIndirect:
-		case VirtualMachine::IndirectRIndirect:
-		case VirtualMachine::RIndirectImmediate:
-		case VirtualMachine::RIndirectRegister:
-		case VirtualMachine::RIndirectIndirect:
-		case VirtualMachine::RIndirectRIndirect:
-			printf ("call %s impossible", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-		case VirtualMachine::Immediate:
-		{
-			this->pushq (this->registers->PC + 4);
-			uint32_t addr = this->memory->readq (this->registers->PC);
-			printf ("call %08X", addr);
-			this->registers->PC = addr;
-			break;
-		}
-		default:
-			printf ("call %s unimplemented", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-	}
-}
-
-void VirtualMachine::CALLE () {
-	addressing_mode mode = (addressing_mode) this->memory->readw (this->registers->PC++);
-
-	switch (mode) {
-		case VirtualMachine::ImmediateImmediate:
-		case VirtualMachine::ImmediateRegister:
-		case VirtualMachine::ImmediateIndirect:
-		case VirtualMachine::ImmediateRindirect:
-		case VirtualMachine::RegisterImmediate:
-		case VirtualMachine::RegisterRegister:
-		case VirtualMachine::RegisterIndirect:
-		case VirtualMachine::RegisterRindirect:
-		case VirtualMachine::IndirectImmediate:
-		case VirtualMachine::IndirectRegister:
-		case VirtualMachine::IndirectIndirect:
-		case VirtualMachine::IndirectRIndirect:
-		case VirtualMachine::RIndirectImmediate:
-		case VirtualMachine::RIndirectRegister:
-		case VirtualMachine::RIndirectIndirect:
-		case VirtualMachine::RIndirectRIndirect:
-			printf ("calle %s impossible", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-		case VirtualMachine::Immediate:
-		{
-			uint32_t addr = this->memory->readq (this->registers->PC);
-			printf ("calle %08X", addr);
-			if (this->registers->Flags & Zero) {
-				this->pushq (this->registers->PC + 4);
-				this->registers->PC = addr;
-			} else
-				this->registers->PC += 4;
-			break;
-		}
-		default:
-			printf ("calle %s unimplemented", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-	}
-}
-
-void VirtualMachine::MUL () {
-	addressing_mode mode = (addressing_mode) this->memory->readw (this->registers->PC++);
-
-	switch (mode) {
-		case VirtualMachine::RegisterImmediate:
-		{
-			size sz = (size) this->memory->readw (this->registers->PC++);
-			uint8_t reg = this->memory->readw (this->registers->PC++);
-			uint32_t reg_val = read_reg (reg);
-			printf ("mul %s, ", this->reg_name (reg));
-			uint32_t val = this->read_val (sz);
-			
-			this->set_reg (reg, reg_val * val);
-
-			break;
-		}
-		default:
-			printf ("mul %s unimplemented", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-	}
-}
-
-void VirtualMachine::ADD () {
-	addressing_mode mode = (addressing_mode) this->memory->readw (this->registers->PC++);
-
-	switch (mode) {
-		case VirtualMachine::RegisterRegister:
-		{
-			size sz = (size) this->memory->readw (this->registers->PC++);
-			uint8_t a = this->memory->readw (this->registers->PC++);
-			uint32_t a_val = read_reg (a);
-			uint8_t b = this->memory->readw (this->registers->PC++);
-			uint32_t b_val = read_reg (b);
-			printf ("add %s, %s", this->reg_name (a), this->reg_name (b));
-
-			this->set_reg (a, a_val + b_val);
-
-			break;
-		}
-		case VirtualMachine::RegisterImmediate:
-		{
-			size sz = (size) this->memory->readw (this->registers->PC++);
-			uint8_t a = this->memory->readw (this->registers->PC++);
-			uint32_t a_val = read_reg (a);
-			printf ("add %s, ", this->reg_name (a));
-			uint32_t val = this->read_val (sz);
-
-			this->set_reg (a, a_val + val);
-
-			break;
-		}
-		default:
-			printf ("add %s unimplemented", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-	}
-}
-
-void VirtualMachine::RET () {
-	this->registers->PC = this->popq ();
-	printf ("ret");
-}
-
-void VirtualMachine::LDIDT () {
-	addressing_mode mode = (addressing_mode) this->memory->readw (this->registers->PC++);
-
-	switch (mode) {
-		case VirtualMachine::ImmediateImmediate:
-		case VirtualMachine::ImmediateRegister:
-		case VirtualMachine::ImmediateIndirect:
-		case VirtualMachine::ImmediateRindirect:
-		case VirtualMachine::RegisterImmediate:
-		case VirtualMachine::RegisterRegister:
-		case VirtualMachine::RegisterIndirect:
-		case VirtualMachine::RegisterRindirect:
-		case VirtualMachine::IndirectImmediate:
-		case VirtualMachine::IndirectRegister:
-		case VirtualMachine::IndirectIndirect:
-		case VirtualMachine::IndirectRIndirect:
-		case VirtualMachine::RIndirectImmediate:
-		case VirtualMachine::RIndirectRegister:
-		case VirtualMachine::RIndirectIndirect:
-		case VirtualMachine::RIndirectRIndirect:
-			printf ("ldidt %s impossible", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-		case VirtualMachine::Immediate:
-		{
-			uint32_t addr = this->memory->readq (this->registers->PC);
-			this->registers->PC += 4;
-			printf ("ldidt %08X", addr);
-			this->int_descs = (int_desc *) (this->memory->memory + addr);
-			break;
-		}
-		default:
-			printf ("ldidt %s unimplemented", addressing_name (mode));
-			this->status = Halted | Fault;
-			break;
-	}
-}
-
-void VirtualMachine::IRET () {
-	this->status = this->popq ();
-	this->registers->PC = this->popq ();
-	printf ("iret");
-}
-
-void VirtualMachine::PUSHA () {
-	this->mpusha ();
-}
-
-void VirtualMachine::POPA () {
-	this->mpopa ();
-}
-
-void VirtualMachine::interrupt (uint8_t line) {
-	if (interrupts_enabled) {
-		this->inter = true;
-		this->int_line = line;
-	}
-}
-
-void VirtualMachine::Start (char *path) {
-	for (Hardware *hw : this->hardware)
-		hw->Start ();
-
-	this->status |= On;
-
-	for (int i = 0; i < 16; i++)
-		this->memory->writeq (0xA0000 + (i * 4), colors[i]);
-
-	std::ifstream input (path, std::ios::binary);
-	std::vector<char> data ((std::istreambuf_iterator<char> (input)),
-	(std::istreambuf_iterator<char> ()));
-
-	for (size_t s = 0; s < data.size (); s++)
-		this->memory->writew (s, data[s]);
-
-	this->timer = new Timer (1024000);
-	this->timer->Tick = [&] (uint64_t delta, uint64_t total) {
-		std::lock_guard<std::mutex> (this->lock);
-		if (!(this->status & Halted) && this->status & On) {
-			printf ("%08X: ", this->registers->PC);
-			(this->*instructions[this->memory->readw(this->registers->PC++)]) ();
-			printf ("\n");
-		}
-
-		if (inter && interrupts_enabled) {
-			if (this->status & Halted)
-				this->status ^= Halted;
-			this->pushq (this->registers->PC);
-			this->pushq (this->status);
-			this->registers->PC = int_descs[int_line].address;
-			this->inter = false;
-		}
-
-		if (this->status == Off) {
-			for (Hardware *hw : this->hardware)
-				hw->Stop ();
-			this->status |= Halted;
-		}
-	};
-	this->timer->Start ();
-}
-
-void VirtualMachine::pushw (uint8_t val) {
-	this->registers->SP--;
-	memory->writew (read_reg (SP), val);
-}
-void VirtualMachine::pushd (uint16_t val) {
-	this->registers->SP -= 2;
-	memory->writed (read_reg (SP), val);
-}
-void VirtualMachine::pushq (uint32_t val) {
-	this->registers->SP -= 4;
-	memory->writeq (read_reg (SP), val);
-}
-
-uint8_t VirtualMachine::popw () {
-	this->registers->SP++;
-	auto temp = memory->readw (read_reg (SP));
-	return temp;
-}
-uint16_t VirtualMachine::popd () {
-	this->registers->SP += 2;
-	auto temp = memory->readd (read_reg (SP));
-	return temp;
-}
-uint32_t VirtualMachine::popq () {
-	auto temp = memory->readq (read_reg (SP));
-	this->registers->SP += 4;
-	return temp;
-}
-
-void VirtualMachine::mpusha () {
-	this->pushq (this->registers->A.qword);
-	this->pushq (this->registers->B.qword);
-	this->pushq (this->registers->C.qword);
-	this->pushq (this->registers->D.qword);
-	this->pushq (this->registers->E.qword);
-	this->pushq (this->registers->F.qword);
-	this->pushq (this->registers->W.qword);
-	this->pushq (this->registers->X.qword);
-	this->pushq (this->registers->Y.qword);
-	this->pushq (this->registers->Z.qword);
-	this->pushd (this->registers->Flags);
-	this->pushd (this->registers->Clocks);
-	this->pushq (this->registers->CS);
-	this->pushq (this->registers->DS);
-	this->pushq (this->registers->SS);
-	this->pushq (this->registers->PC);
-	this->pushq (this->registers->SP);
-	this->pushq (this->registers->BP);
-}
-
-void VirtualMachine::mpopa () {
-	this->pushq (this->registers->BP);
-	this->pushq (this->registers->SP);
-	this->pushq (this->registers->PC);
-	this->pushq (this->registers->SS);
-	this->pushq (this->registers->DS);
-	this->pushq (this->registers->CS);
-	this->pushd (this->registers->Clocks);
-	this->pushd (this->registers->Flags);
-	this->pushq (this->registers->Z.qword);
-	this->pushq (this->registers->Y.qword);
-	this->pushq (this->registers->X.qword);
-	this->pushq (this->registers->W.qword);
-	this->pushq (this->registers->F.qword);
-	this->pushq (this->registers->E.qword);
-	this->pushq (this->registers->D.qword);
-	this->pushq (this->registers->C.qword);
-	this->pushq (this->registers->B.qword);
-	this->pushq (this->registers->A.qword);
-}
-
-uint32_t VirtualMachine::read_reg (uint8_t reg) {
-	registers_enum reg_enum = (registers_enum) reg;
-
-	switch (reg_enum) {
-		case VirtualMachine::A:
-			return this->registers->A.qword;
-		case VirtualMachine::AH:
-			return this->registers->A.dword.H;
-		case VirtualMachine::AL:
-			return this->registers->A.dword.L;
-		case VirtualMachine::AHH:
-			return this->registers->A.word.HH;
-		case VirtualMachine::AHL:
-			return this->registers->A.word.HL;
-		case VirtualMachine::ALH:
-			return this->registers->A.word.LH;
-		case VirtualMachine::ALL:
-			return this->registers->A.word.LL;
-		case VirtualMachine::B:
-			return this->registers->B.qword;
-		case VirtualMachine::BH:
-			return this->registers->B.dword.H;
-		case VirtualMachine::BL:
-			return this->registers->B.dword.L;
-		case VirtualMachine::BHH:
-			return this->registers->B.word.HH;
-		case VirtualMachine::BHL:
-			return this->registers->B.word.HL;
-		case VirtualMachine::BLH:
-			return this->registers->B.word.LH;
-		case VirtualMachine::BLL:
-			return this->registers->B.word.LL;
-		case VirtualMachine::C:
-			return this->registers->C.qword;
-		case VirtualMachine::CH:
-			return this->registers->C.dword.H;
-		case VirtualMachine::CL:
-			return this->registers->C.dword.L;
-		case VirtualMachine::CHH:
-			return this->registers->C.word.HH;
-		case VirtualMachine::CHL:
-			return this->registers->C.word.HL;
-		case VirtualMachine::CLH:
-			return this->registers->C.word.LH;
-		case VirtualMachine::CLL:
-			return this->registers->C.word.LL;
-		case VirtualMachine::D:
-			return this->registers->D.qword;
-		case VirtualMachine::DH:
-			return this->registers->D.dword.H;
-		case VirtualMachine::DL:
-			return this->registers->D.dword.L;
-		case VirtualMachine::DHH:
-			return this->registers->D.word.HH;
-		case VirtualMachine::DHL:
-			return this->registers->D.word.HL;
-		case VirtualMachine::DLH:
-			return this->registers->D.word.LH;
-		case VirtualMachine::DLL:
-			return this->registers->D.word.LL;
-		case VirtualMachine::E:
-			return this->registers->E.qword;
-		case VirtualMachine::EH:
-			return this->registers->E.dword.H;
-		case VirtualMachine::EL:
-			return this->registers->E.dword.L;
-		case VirtualMachine::EHH:
-			return this->registers->E.word.HH;
-		case VirtualMachine::EHL:
-			return this->registers->E.word.HL;
-		case VirtualMachine::ELH:
-			return this->registers->E.word.LH;
-		case VirtualMachine::ELL:
-			return this->registers->E.word.LL;
-		case VirtualMachine::F:
-			return this->registers->F.qword;
-		case VirtualMachine::FH:
-			return this->registers->F.dword.H;
-		case VirtualMachine::FL:
-			return this->registers->F.dword.L;
-		case VirtualMachine::FHH:
-			return this->registers->F.word.HH;
-		case VirtualMachine::FHL:
-			return this->registers->F.word.HL;
-		case VirtualMachine::FLH:
-			return this->registers->F.word.LH;
-		case VirtualMachine::FLL:
-			return this->registers->F.word.LL;
-		case VirtualMachine::W:
-			return this->registers->W.qword;
-		case VirtualMachine::WH:
-			return this->registers->W.dword.H;
-		case VirtualMachine::WL:
-			return this->registers->W.dword.L;
-		case VirtualMachine::WHH:
-			return this->registers->W.word.HH;
-		case VirtualMachine::WHL:
-			return this->registers->W.word.HL;
-		case VirtualMachine::WLH:
-			return this->registers->W.word.LH;
-		case VirtualMachine::WLL:
-			return this->registers->W.word.LL;
-		case VirtualMachine::X:
-			return this->registers->X.qword;
-		case VirtualMachine::XH:
-			return this->registers->X.dword.H;
-		case VirtualMachine::XL:
-			return this->registers->X.dword.L;
-		case VirtualMachine::XHH:
-			return this->registers->X.word.HH;
-		case VirtualMachine::XHL:
-			return this->registers->X.word.HL;
-		case VirtualMachine::XLH:
-			return this->registers->X.word.LH;
-		case VirtualMachine::XLL:
-			return this->registers->X.word.LL;
-		case VirtualMachine::Y:
-			return this->registers->Y.qword;
-		case VirtualMachine::YH:
-			return this->registers->Y.dword.H;
-		case VirtualMachine::YL:
-			return this->registers->Y.dword.L;
-		case VirtualMachine::YHH:
-			return this->registers->Y.word.HH;
-		case VirtualMachine::YHL:
-			return this->registers->Y.word.HL;
-		case VirtualMachine::YLH:
-			return this->registers->Y.word.LH;
-		case VirtualMachine::YLL:
-			return this->registers->Y.word.LL;
-		case VirtualMachine::Z:
-			return this->registers->Z.qword;
-		case VirtualMachine::ZH:
-			return this->registers->Z.dword.H;
-		case VirtualMachine::ZL:
-			return this->registers->Z.dword.L;
-		case VirtualMachine::ZHH:
-			return this->registers->Z.word.HH;
-		case VirtualMachine::ZHL:
-			return this->registers->Z.word.HL;
-		case VirtualMachine::ZLH:
-			return this->registers->Z.word.LH;
-		case VirtualMachine::ZLL:
-			return this->registers->Z.word.LL;
-		case VirtualMachine::Flags:
-			return this->registers->Flags;
-		case VirtualMachine::Clocks:
-			return this->registers->Clocks;
-		case VirtualMachine::CS:
-			return this->registers->CS;
-		case VirtualMachine::DS:
-			return this->registers->DS;
-		case VirtualMachine::SS:
-			return this->registers->SS;
-		case VirtualMachine::PC:
-			return this->registers->PC;
-		case VirtualMachine::SP:
-			return this->registers->SP;
-		case VirtualMachine::BP:
-			return this->registers->BP;
-	}
-}
-
-void VirtualMachine::set_reg (uint8_t reg, uint32_t val) {
-	registers_enum renum = (registers_enum) reg;
-
-	switch (renum) {
-		case VirtualMachine::A:
-			this->registers->A.qword = val;
-			break;
-		case VirtualMachine::AH:
-			this->registers->A.dword.H = val;
-			break;
-		case VirtualMachine::AL:
-			this->registers->A.dword.L = val;
-			break;
-		case VirtualMachine::AHH:
-			this->registers->A.word.HH = val;
-			break;
-		case VirtualMachine::AHL:
-			this->registers->A.word.HL = val;
-			break;
-		case VirtualMachine::ALH:
-			this->registers->A.word.LH = val;
-			break;
-		case VirtualMachine::ALL:
-			this->registers->A.word.LL = val;
-			break;
-		case VirtualMachine::B:
-			this->registers->B.qword = val;
-			break;
-		case VirtualMachine::BH:
-			this->registers->B.dword.H = val;
-			break;
-		case VirtualMachine::BL:
-			this->registers->B.dword.L = val;
-			break;
-		case VirtualMachine::BHH:
-			this->registers->B.word.HH = val;
-			break;
-		case VirtualMachine::BHL:
-			this->registers->B.word.HL = val;
-			break;
-		case VirtualMachine::BLH:
-			this->registers->B.word.LH = val;
-			break;
-		case VirtualMachine::BLL:
-			this->registers->B.word.LL = val;
-			break;
-		case VirtualMachine::C:
-			this->registers->C.qword = val;
-			break;
-		case VirtualMachine::CH:
-			this->registers->C.dword.H = val;
-			break;
-		case VirtualMachine::CL:
-			this->registers->C.dword.L = val;
-			break;
-		case VirtualMachine::CHH:
-			this->registers->C.word.HH = val;
-			break;
-		case VirtualMachine::CHL:
-			this->registers->C.word.HL = val;
-			break;
-		case VirtualMachine::CLH:
-			this->registers->C.word.LH = val;
-			break;
-		case VirtualMachine::CLL:
-			this->registers->C.word.LL = val;
-			break;
-		case VirtualMachine::D:
-			this->registers->D.qword = val;
-			break;
-		case VirtualMachine::DH:
-			this->registers->D.dword.H = val;
-			break;
-		case VirtualMachine::DL:
-			this->registers->D.dword.L = val;
-			break;
-		case VirtualMachine::DHH:
-			this->registers->D.word.HH = val;
-			break;
-		case VirtualMachine::DHL:
-			this->registers->D.word.HL = val;
-			break;
-		case VirtualMachine::DLH:
-			this->registers->D.word.LH = val;
-			break;
-		case VirtualMachine::DLL:
-			this->registers->D.word.LL = val;
-			break;
-		case VirtualMachine::E:
-			this->registers->E.qword = val;
-			break;
-		case VirtualMachine::EH:
-			this->registers->E.dword.H = val;
-			break;
-		case VirtualMachine::EL:
-			this->registers->E.dword.L = val;
-			break;
-		case VirtualMachine::EHH:
-			this->registers->E.word.HH = val;
-			break;
-		case VirtualMachine::EHL:
-			this->registers->E.word.HL = val;
-			break;
-		case VirtualMachine::ELH:
-			this->registers->E.word.LH = val;
-			break;
-		case VirtualMachine::ELL:
-			this->registers->E.word.LL = val;
-			break;
-		case VirtualMachine::F:
-			this->registers->F.qword = val;
-			break;
-		case VirtualMachine::FH:
-			this->registers->F.dword.H = val;
-			break;
-		case VirtualMachine::FL:
-			this->registers->F.dword.L = val;
-			break;
-		case VirtualMachine::FHH:
-			this->registers->F.word.HH = val;
-			break;
-		case VirtualMachine::FHL:
-			this->registers->F.word.HL = val;
-			break;
-		case VirtualMachine::FLH:
-			this->registers->F.word.LH = val;
-			break;
-		case VirtualMachine::FLL:
-			this->registers->F.word.LL = val;
-			break;
-		case VirtualMachine::W:
-			this->registers->W.qword = val;
-			break;
-		case VirtualMachine::WH:
-			this->registers->W.dword.H = val;
-			break;
-		case VirtualMachine::WL:
-			this->registers->W.dword.L = val;
-			break;
-		case VirtualMachine::WHH:
-			this->registers->W.word.HH = val;
-			break;
-		case VirtualMachine::WHL:
-			this->registers->W.word.HL = val;
-			break;
-		case VirtualMachine::WLH:
-			this->registers->W.word.LH = val;
-			break;
-		case VirtualMachine::WLL:
-			this->registers->W.word.LL = val;
-			break;
-		case VirtualMachine::X:
-			this->registers->X.qword = val;
-			break;
-		case VirtualMachine::XH:
-			this->registers->X.dword.H = val;
-			break;
-		case VirtualMachine::XL:
-			this->registers->X.dword.L = val;
-			break;
-		case VirtualMachine::XHH:
-			this->registers->X.word.HH = val;
-			break;
-		case VirtualMachine::XHL:
-			this->registers->X.word.HL = val;
-			break;
-		case VirtualMachine::XLH:
-			this->registers->X.word.LH = val;
-			break;
-		case VirtualMachine::XLL:
-			this->registers->X.word.LL = val;
-			break;
-		case VirtualMachine::Y:
-			this->registers->Y.qword = val;
-			break;
-		case VirtualMachine::YH:
-			this->registers->Y.dword.H = val;
-			break;
-		case VirtualMachine::YL:
-			this->registers->Y.dword.L = val;
-			break;
-		case VirtualMachine::YHH:
-			this->registers->Y.word.HH = val;
-			break;
-		case VirtualMachine::YHL:
-			this->registers->Y.word.HL = val;
-			break;
-		case VirtualMachine::YLH:
-			this->registers->Y.word.LH = val;
-			break;
-		case VirtualMachine::YLL:
-			this->registers->Y.word.LL = val;
-			break;
-		case VirtualMachine::Z:
-			this->registers->Z.qword = val;
-			break;
-		case VirtualMachine::ZH:
-			this->registers->Z.dword.H = val;
-			break;
-		case VirtualMachine::ZL:
-			this->registers->Z.dword.L = val;
-			break;
-		case VirtualMachine::ZHH:
-			this->registers->Z.word.HH = val;
-			break;
-		case VirtualMachine::ZHL:
-			this->registers->Z.word.HL = val;
-			break;
-		case VirtualMachine::ZLH:
-			this->registers->Z.word.LH = val;
-			break;
-		case VirtualMachine::ZLL:
-			this->registers->Z.word.LL = val;
-			break;
-		case VirtualMachine::Flags:
-			this->registers->Flags = val;
-			break;
-		case VirtualMachine::Clocks:
-			this->registers->Clocks = val;
-			break;
-		case VirtualMachine::CS:
-			this->registers->CS = val;
-			break;
-		case VirtualMachine::DS:
-			this->registers->DS = val;
-			break;
-		case VirtualMachine::SS:
-			this->registers->SS = val;
-			break;
-		case VirtualMachine::PC:
-			this->registers->PC = val;
-			break;
-		case VirtualMachine::SP:
-			this->registers->SP = val;
-			break;
-		case VirtualMachine::BP:
-			this->registers->BP = val;
-			break;
-	}
-}
-
-const char *VirtualMachine::reg_name (uint8_t reg) {
-	registers_enum rege = (registers_enum) reg;
-
-	switch (rege) {
-		case VirtualMachine::A:
-			return "A";
-		case VirtualMachine::AH:
-			return "AH";
-		case VirtualMachine::AL:
-			return "AL";
-		case VirtualMachine::AHH:
-			return "AHH";
-		case VirtualMachine::AHL:
-			return "AHL";
-		case VirtualMachine::ALH:
-			return "ALH";
-		case VirtualMachine::ALL:
-			return "ALL";
-		case VirtualMachine::B:
-			return "B";
-		case VirtualMachine::BH:
-			return "BH";
-		case VirtualMachine::BL:
-			return "BL";
-		case VirtualMachine::BHH:
-			return "BHH";
-		case VirtualMachine::BHL:
-			return "BHL";
-		case VirtualMachine::BLH:
-			return "BLH";
-		case VirtualMachine::BLL:
-			return "BLL";
-		case VirtualMachine::C:
-			return "C";
-		case VirtualMachine::CH:
-			return "CH";
-		case VirtualMachine::CL:
-			return "CL";
-		case VirtualMachine::CHH:
-			return "CHH";
-		case VirtualMachine::CHL:
-			return "CHL";
-		case VirtualMachine::CLH:
-			return "CLH";
-		case VirtualMachine::CLL:
-			return "CLL";
-		case VirtualMachine::D:
-			return "D";
-		case VirtualMachine::DH:
-			return "DH";
-		case VirtualMachine::DL:
-			return "DL";
-		case VirtualMachine::DHH:
-			return "DHH";
-		case VirtualMachine::DHL:
-			return "DHL";
-		case VirtualMachine::DLH:
-			return "DLH";
-		case VirtualMachine::DLL:
-			return "DLL";
-		case VirtualMachine::E:
-			return "E";
-		case VirtualMachine::EH:
-			return "EH";
-		case VirtualMachine::EL:
-			return "EL";
-		case VirtualMachine::EHH:
-			return "EHH";
-		case VirtualMachine::EHL:
-			return "EHL";
-		case VirtualMachine::ELH:
-			return "ELH";
-		case VirtualMachine::ELL:
-			return "ELL";
-		case VirtualMachine::F:
-			return "F";
-		case VirtualMachine::FH:
-			return "FH";
-		case VirtualMachine::FL:
-			return "FL";
-		case VirtualMachine::FHH:
-			return "FHH";
-		case VirtualMachine::FHL:
-			return "FHL";
-		case VirtualMachine::FLH:
-			return "FLH";
-		case VirtualMachine::FLL:
-			return "FLL";
-		case VirtualMachine::W:
-			return "W";
-		case VirtualMachine::WH:
-			return "WH";
-		case VirtualMachine::WL:
-			return "WL";
-		case VirtualMachine::WHH:
-			return "WHH";
-		case VirtualMachine::WHL:
-			return "WHL";
-		case VirtualMachine::WLH:
-			return "WLH";
-		case VirtualMachine::WLL:
-			return "WLL";
-		case VirtualMachine::X:
-			return "X";
-		case VirtualMachine::XH:
-			return "XH";
-		case VirtualMachine::XL:
-			return "XL";
-		case VirtualMachine::XHH:
-			return "XHH";
-		case VirtualMachine::XHL:
-			return "XHL";
-		case VirtualMachine::XLH:
-			return "XLH";
-		case VirtualMachine::XLL:
-			return "XLL";
-		case VirtualMachine::Y:
-			return "Y";
-		case VirtualMachine::YH:
-			return "YH";
-		case VirtualMachine::YL:
-			return "YL";
-		case VirtualMachine::YHH:
-			return "YHH";
-		case VirtualMachine::YHL:
-			return "YHL";
-		case VirtualMachine::YLH:
-			return "YLH";
-		case VirtualMachine::YLL:
-			return "YLL";
-		case VirtualMachine::Z:
-			return "Z";
-		case VirtualMachine::ZH:
-			return "ZH";
-		case VirtualMachine::ZL:
-			return "ZL";
-		case VirtualMachine::ZHH:
-			return "ZHH";
-		case VirtualMachine::ZHL:
-			return "ZHL";
-		case VirtualMachine::ZLH:
-			return "ZLH";
-		case VirtualMachine::ZLL:
-			return "ZLL";
-		case VirtualMachine::Flags:
-			return "Flags";
-		case VirtualMachine::Clocks:
-			return "Clocks";
-		case VirtualMachine::CS:
-			return "CS";
-		case VirtualMachine::DS:
-			return "DS";
-		case VirtualMachine::SS:
-			return "SS";
-		case VirtualMachine::PC:
-			return "PC";
-		case VirtualMachine::SP:
-			return "SP";
-		case VirtualMachine::BP:
-			return "BP";
-	}
-}
-
-const char *VirtualMachine::addressing_name (addressing_mode mode) {
-	switch (mode) {
-		case VirtualMachine::ImmediateImmediate:
-			return "Immediate Immediate";
-		case VirtualMachine::ImmediateRegister:
-			return "Immediate Register";
-		case VirtualMachine::ImmediateIndirect:
-			return "Immediate Indirect";
-		case VirtualMachine::ImmediateRindirect:
-			return "Immediate RegisterIndirect";
-		case VirtualMachine::RegisterImmediate:
-			return "Register Immediate";
-		case VirtualMachine::RegisterRegister:
-			return "Register Register";
-		case VirtualMachine::RegisterIndirect:
-			return "Register Indirect";
-		case VirtualMachine::RegisterRindirect:
-			return "Register RegisterIndirect";
-		case VirtualMachine::IndirectImmediate:
-			return "Indirect Immediate";
-		case VirtualMachine::IndirectRegister:
-			return "Indirect Register";
-		case VirtualMachine::IndirectIndirect:
-			return "Indirect Indirect";
-		case VirtualMachine::IndirectRIndirect:
-			return "Indirect RegisterIndirect";
-		case VirtualMachine::RIndirectImmediate:
-			return "RegisterIndirect Immediate";
-		case VirtualMachine::RIndirectRegister:
-			return "RegisterIndirect Register";
-		case VirtualMachine::RIndirectIndirect:
-			return "RegisterIndirect Indirect";
-		case VirtualMachine::RIndirectRIndirect:
-			return "RegisterIndirect RegisterIndirect";
-		case VirtualMachine::Immediate:
-			return "Immediate";
-		case VirtualMachine::Register:
-			return "Register";
-		case VirtualMachine::Indirect:
-			return "Indirect";
-		case VirtualMachine::RIndirect:
-			return "RegisterIndirect";
-	}
-}
-
-uint32_t VirtualMachine::read_val_n (size sz, uint32_t addr) {
-	uint32_t val;
-	switch (sz) {
-		case VirtualMachine::word:
-			val = this->memory->readw (addr);
-			break;
-		case VirtualMachine::dword:
-			val = this->memory->readd (addr);
-			break;
-		case VirtualMachine::qword:
-			val = this->memory->readq (addr);
-			break;
-	}
-	return val;
-}
-
-uint32_t VirtualMachine::read_val (size sz) {
-	uint32_t val;
-	switch (sz) {
-		case VirtualMachine::word:
-			val = this->memory->readw (this->registers->PC++);
-			printf ("$%02X", val);
-			break;
-		case VirtualMachine::dword:
-			val = this->memory->readd (this->registers->PC);
-			this->registers->PC += 2;
-			printf ("$%04X", val);
-			break;
-		case VirtualMachine::qword:
-			val = this->memory->readq (this->registers->PC);
-			this->registers->PC += 4;
-			printf ("$%08X", val);
-			break;
-	}
-	return val;
-}
-
-void VirtualMachine::write_val (size sz, uint32_t addr) {
-	uint32_t val;
-	switch (sz) {
-		case VirtualMachine::word:
-			printf ("($%08X), ", addr);
-			val = read_val (sz);
-			memory->writew (addr, val);
-			break;
-		case VirtualMachine::dword:
-			printf ("($%08X), ", addr);
-			val = read_val (sz);
-			memory->writed (addr, val);
-			break;
-		case VirtualMachine::qword:
-			printf ("($%08X), ", addr);
-			val = read_val (sz);
-			memory->writeq (addr, val);
-			break;
-	}
-}
-
-void VirtualMachine::write_reg (size sz, uint32_t addr, uint8_t reg) {
-	switch (sz) {
-		case VirtualMachine::word:
-		{
-			uint8_t val = read_reg (reg);
-			printf ("($%08X), %s", addr, reg_name (reg));
-			memory->writew (addr, val);
-			break;
-		}
-		case VirtualMachine::dword:
-		{
-			uint16_t val = read_reg (reg);
-			printf ("($%08X), %s", addr, reg_name (reg));
-			memory->writed (addr, val);
-			break;
-		}
-		case VirtualMachine::qword:
-		{
-			uint32_t val = read_reg (reg);
-			printf ("($%08X), %s", addr, reg_name (reg));
-			memory->writeq (addr, val);
-			break;
-		}
-	}
-}
-
-void VirtualMachine::write_reg_ind (size sz, uint8_t reg, uint8_t reg2) {
-	uint32_t addr = read_reg (reg);
-	
-	switch (sz) {
-		case VirtualMachine::word:
-		{
-			uint8_t val = read_reg (reg2);
-			printf ("(%s), %s", reg_name (reg), reg_name (reg2));
-			memory->writew (addr, val);
-			break;
-		}
-		case VirtualMachine::dword:
-		{
-			uint16_t val = read_reg (reg2);
-			printf ("(%s), %s", reg_name (reg), reg_name (reg2));
-			memory->writed (addr, val);
-			break;
-		}
-		case VirtualMachine::qword:
-		{
-			uint32_t val = read_reg (reg2);
-			printf ("(%s), %s", reg_name (reg), reg_name (reg2));
-			memory->writeq (addr, val);
-			break;
-		}
-	}
-}
-
-void VirtualMachine::set_reg_reg (size sz, uint8_t a, uint8_t b) {
-	switch (sz) {
-		case VirtualMachine::word:
-		{
-			uint32_t aval = read_reg (a);
-			uint8_t bval = read_reg (b);
-			printf ("%s, %s", reg_name (a), reg_name (b));
-			this->set_reg (a, (aval & 0xFFFFFF00) | bval);
-			break;
-		}
-		case VirtualMachine::dword:
-		{
-			uint32_t aval = read_reg (a);
-			uint16_t bval = read_reg (b);
-			printf ("%s, %s", reg_name (a), reg_name (b));
-			this->set_reg (a, (aval & 0xFFFF0000) | bval);
-			break;
-		}
-		case VirtualMachine::qword:
-		{
-			uint32_t aval = read_reg (a);
-			uint16_t bval = read_reg (b);
-			printf ("%s, %s", reg_name (a), reg_name (b));
-			this->set_reg (a, bval);
-			break;
-		}
-	}
-}
-
-void VirtualMachine::write_reg_rind_val (size sz, uint8_t reg) {
-	uint32_t addr = read_reg (reg);
-
-	switch (sz) {
-		case VirtualMachine::word:
-		{
-			printf ("(%s), ", reg_name (reg));
-			memory->writew (addr, read_val (sz));
-			break;
-		}
-		case VirtualMachine::dword:
-		{
-			printf ("(%s), ", reg_name (reg));
-			memory->writed (addr, read_val (sz));
-			break;
-		}
-		case VirtualMachine::qword:
-		{
-			printf ("(%s), ", reg_name (reg));
-			memory->writeq (addr, read_val (sz));
-			break;
-		}
-	}
-}
-
-void VirtualMachine::write_reg_rind_val_ind (size sz, uint8_t reg, uint32_t vaddr) {
-	uint32_t addr = read_reg (reg);
-
-	switch (sz) {
-		case VirtualMachine::word:
-		{
-			printf ("(%s), ($%02X)", reg_name (reg), vaddr);
-			memory->writew (addr, memory->readw (vaddr));
-			break;
-		}
-		case VirtualMachine::dword:
-		{
-			printf ("(%s), ($%04X)", reg_name (reg), vaddr);
-			memory->writed (addr, memory->readd (vaddr));
-			break;
-		}
-		case VirtualMachine::qword:
-		{
-			printf ("(%s), ($%08X)", reg_name (reg), vaddr);
-			memory->writeq (addr, memory->readq (vaddr));
-			break;
-		}
-	}
-}
-
-uint32_t VirtualMachine::read_reg_ind (size sz, uint8_t reg) {
-	uint32_t val;
-	switch (sz) {
-		case VirtualMachine::word:
-			val = memory->readw(read_reg (reg));
-			printf ("(%s)", reg_name (reg));
-			break;
-		case VirtualMachine::dword:
-			val = memory->readd (read_reg (reg));
-			printf ("(%s)", reg_name (reg));
-			break;
-		case VirtualMachine::qword:
-			val = memory->readq (read_reg (reg));
-			printf ("(%s)", reg_name (reg));
-			break;
-	}
-	return val;
-}
-
-void VirtualMachine::AddHardware (Hardware *hardware) {
-	this->hardware.push_back (hardware);
-}
-void VirtualMachine::AddMemoryRegion (MemoryRegion *region) {
-	this->memory->AddMemoryRegion (region);
-}
-
-void VirtualMachine::minb (uint8_t port, uint8_t value) {
-	if (has_in (port, b))
-		inp (port, b, value);
-}
-void VirtualMachine::mind (uint8_t port, uint16_t value) {
-	if (has_in (port, d))
-		inp (port, d, value);
-}
-void VirtualMachine::minq (uint8_t port, uint32_t value) {
-	if (has_in (port, q))
-		inp (port, q, value);
-}
-
-uint8_t VirtualMachine::moutb (uint8_t port) {
-	if (has_out (port, b))
-		return outp (port, b);
-	return 0;
-}
-uint16_t VirtualMachine::moutd (uint8_t port) {
-	if (has_out (port, d))
-		return outp (port, d);
-	return 0;
-}
-uint32_t VirtualMachine::moutq (uint8_t port) {
-	if (has_out (port, q))
-		return outp (port, q);
-	return 0;
-}
+#include "VirtualMachine.h"
+
+#include "Hardware.h"
+
+#include <fstream>
+#include <string.h>
+
+// Default string handlers: repeat the port's byte handler once per byte
+static void repeat_inb (void *port, const uint8_t *data, uint32_t count) {
+	for (uint32_t i = 0; i < count; i++)
+		(*(VirtualMachine::port_inb *) port) (data[i]);
+}
+static void repeat_outb (void *port, uint8_t *data, uint32_t count) {
+	for (uint32_t i = 0; i < count; i++)
+		data[i] = (*(VirtualMachine::port_outb *) port) ();
+}
+
+// Unsized handlers ignore S, so only their word variant is instantiated
+#define SPECIALIZE_MODE(handler, M, sized) { \
+	&VirtualMachine::handler<M, VirtualMachine::word>, \
+	&VirtualMachine::handler<M, sized ? VirtualMachine::dword : VirtualMachine::word>, \
+	&VirtualMachine::handler<M, sized ? VirtualMachine::qword : VirtualMachine::word> }
+#define SPECIALIZE(handler, sized) { \
+	SPECIALIZE_MODE (handler, 0, sized), SPECIALIZE_MODE (handler, 1, sized), \
+	SPECIALIZE_MODE (handler, 2, sized), SPECIALIZE_MODE (handler, 3, sized), \
+	SPECIALIZE_MODE (handler, 4, sized), SPECIALIZE_MODE (handler, 5, sized), \
+	SPECIALIZE_MODE (handler, 6, sized), SPECIALIZE_MODE (handler, 7, sized), \
+	SPECIALIZE_MODE (handler, 8, sized), SPECIALIZE_MODE (handler, 9, sized), \
+	SPECIALIZE_MODE (handler, 10, sized), SPECIALIZE_MODE (handler, 11, sized), \
+	SPECIALIZE_MODE (handler, 12, sized), SPECIALIZE_MODE (handler, 13, sized), \
+	SPECIALIZE_MODE (handler, 14, sized), SPECIALIZE_MODE (handler, 15, sized), \
+	SPECIALIZE_MODE (handler, 16, sized), SPECIALIZE_MODE (handler, 17, sized), \
+	SPECIALIZE_MODE (handler, 18, sized), SPECIALIZE_MODE (handler, 19, sized) }
+#define specialize(op, handler, is_sized) { \
+	static const handler_table table = SPECIALIZE (handler, is_sized); \
+	this->opcodes[op] = { &table, is_sized }; \
+}
+
+static const uint32_t colors[] {
+	0xff1d1f21,
+	0xff5f819d,
+	0xff8c9440,
+	0xff5e8d87,
+	0xffa54242,
+	0xff85678f,
+	0xffde935f,
+	0xff707880,
+	0xff81a2be,
+	0xffb5bd68,
+	0xff8abeb7,
+	0xffcc6666,
+	0xffb294bb,
+	0xfff0c674,
+	0xffc5c8c6,
+};
+
+VirtualMachine::VirtualMachine (uint32_t memorySize) :
+	parked (false) {
+	this->memory = new Memory (memorySize);
+	this->registers = new struct registers ();
+
+	memset (this->registers, 0, sizeof (struct registers));
+	
+	for (int i = 0; i < 256; i++)
+		this->instructions[i] = &VirtualMachine::unimplemented_instruction;
+
+	this->instructions[nop] = &VirtualMachine::NOP;
+	this->instructions[ret] = &VirtualMachine::RET;
+	this->instructions[iret] = &VirtualMachine::IRET;
+	this->instructions[sti] = &VirtualMachine::STI;
+	this->instructions[cli] = &VirtualMachine::CLI;
+	this->instructions[hlt] = &VirtualMachine::HLT;
+
+	for (int i = 0; i < 256; i++)
+		this->opcodes[i] = { nullptr, false };
+
+	specialize (mov, MOV, true);
+	specialize (cmp, CMP, true);
+	specialize (jmp, JMP, false);
+	specialize (je, JE, false);
+	specialize (jne, JNE, false);
+	specialize (jl, JL, false);
+	specialize (call, CALL, false);
+	specialize (calle, CALLE, false);
+	specialize (inc, INC, false);
+	specialize (add, ADD, true);
+	specialize (mul, MUL, true);
+	specialize (or, OR, true);
+	specialize (xor, XOR, false);
+	specialize (shl, SHL, false);
+	specialize (inb, INB, false);
+	specialize (outb, OUTB, false);
+	specialize (inq, INQ, false);
+	specialize (outq, OUTQ, false);
+	specialize (ldidt, LDIDT, false);
+	specialize (insb, INSB, false);
+	specialize (outsb, OUTSB, false);
+
+	for (int port = 0; port < 256; port++) {
+		this->inpsb[port] = port_insb (&this->inpb[port], &repeat_inb);
+		this->outpsb[port] = port_outsb (&this->outpb[port], &repeat_outb);
+	}
+
+	this->pic = new InterruptController (this);
+
+	for (decoded &entry : this->decode_cache) {
+		entry.address = invalid_address;
+		entry.handler = &VirtualMachine::unimplemented_instruction;
+		entry.header = 1;
+		entry.window = 0;
+		entry.block = nullptr;
+		entry.hits = 0;
+	}
+	this->uncached.address = invalid_address;
+	this->uncached.window = 0;
+	this->uncached.block = nullptr;
+
+	this->memory->CodeWritten = [this] (uint32_t page) { this->InvalidateCode (page); };
+}
+
+VirtualMachine::~VirtualMachine () {
+	delete jit;
+	delete pic;
+	delete memory;
+	delete registers;
+}
+
+void VirtualMachine::unimplemented_instruction () {
+	fprintf (stderr, "Opcode: $%02X not implemented\n", this->memory->readw(this->registers->PC - 1));
+	this->status = Halted | Fault;
+}
+
+void VirtualMachine::invalid_encoding () {
+	fprintf (stderr, "Invalid encoding $%02X\n", this->memory->readw (this->registers->PC - 1));
+	this->status = Halted | Fault;
+}
+
+void VirtualMachine::NOP () {
+	trace ("nop");
+}
+
+template <int M, int S>
+void VirtualMachine::OUTB () {
+	const addressing_mode mode = (addressing_mode) M;
+
+	switch (mode) {
+		case VirtualMachine::RegisterImmediate:
+		{
+			uint8_t reg = this->fetchw ();
+			uint8_t port = this->fetchw ();
+
+			trace ("inb %s, $%02X", reg_name (reg), port);
+
+			this->set_reg (reg, this->moutb (port));
+			break;
+		}
+		default:
+			fprintf (stderr, "outb %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+	}
+}
+
+template <int M, int S>
+void VirtualMachine::INB () {
+	const addressing_mode mode = (addressing_mode) M;
+
+	switch (mode) {
+		case VirtualMachine::ImmediateImmediate:
+		{
+			uint8_t port = this->fetchw ();
+			uint8_t val = this->fetchw ();
+
+			trace ("inb $%02X, $%02X", port, val);
+
+			this->minb (port, val);
+			break;
+		}
+		case VirtualMachine::ImmediateRegister:
+		{
+			uint8_t port = this->fetchw ();
+			uint8_t reg = this->fetchw ();
+			uint8_t val = this->read_reg (reg);
+
+			trace ("inb $%02X, %s($%02X)", port, this->reg_name (reg), val);
+
+			this->minb (port, val);
+			break;
+		}
+		case VirtualMachine::ImmediateIndirect:
+		{
+			uint8_t port = this->fetchw ();
+			uint32_t addr = this->fetchq ();
+			uint8_t val = this->memory->readw (addr);
+
+			trace ("inb $%02x, ($%02x)", port, val);
+
+			this->minb (port, val);
+			break;
+		}
+		default:
+			fprintf (stderr, "inb %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+	}
+}
+
+template <int M, int S>
+void VirtualMachine::OUTQ () {
+	const addressing_mode mode = (addressing_mode) M;
+
+	switch (mode) {
+		case VirtualMachine::RegisterImmediate:
+		{
+			uint8_t reg = this->fetchw ();
+			uint8_t port = this->fetchw ();
+
+			trace ("outq %s, $%02X", reg_name (reg), port);
+
+			this->set_reg (reg, this->moutq (port));
+			break;
+		}
+		default:
+			fprintf (stderr, "outq %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+	}
+}
+
+template <int M, int S>
+void VirtualMachine::INQ () {
+	const addressing_mode mode = (addressing_mode) M;
+
+	switch (mode) {
+		case VirtualMachine::ImmediateImmediate:
+		{
+			uint8_t port = this->fetchw ();
+			uint32_t val = this->fetchq ();
+
+			trace ("inq $%02X, $%08X", port, val);
+
+			this->minq (port, val);
+			break;
+		}
+		case VirtualMachine::ImmediateRegister:
+		{
+			uint8_t port = this->fetchw ();
+			uint8_t reg = this->fetchw ();
+			uint32_t val = this->read_reg (reg);
+
+			trace ("inq $%02X, %s($%08X)", port, this->reg_name (reg), val);
+
+			this->minq (port, val);
+			break;
+		}
+		case VirtualMachine::ImmediateIndirect:
+		{
+			uint8_t port = this->fetchw ();
+			uint32_t addr = this->fetchq ();
+			uint32_t val = this->memory->readq (addr);
+
+			trace ("inq $%02x, ($%08x)", port, val);
+
+			this->minq (port, val);
+			break;
+		}
+		default:
+			fprintf (stderr, "inq %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+	}
+}
+
+template <int M, int S>
+void VirtualMachine::MOV () {
+	const addressing_mode mode = (addressing_mode) M;
+
+	switch (mode) {
+		case VirtualMachine::Immediate:
+		case VirtualMachine::Register:
+		case VirtualMachine::Indirect:
+		case VirtualMachine::RIndirect:
+			fprintf (stderr, "mov %s impossible\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+		case VirtualMachine::RegisterImmediate:
+		{
+			const size sz = (size) S;
+			uint8_t reg = this->fetchw ();
+			trace ("mov %s, ", reg_name (reg));
+			uint32_t val = read_val (sz);
+
+			set_reg (reg, val);
+
+			break;
+		}
+		case VirtualMachine::RegisterRindirect:
+		{
+			const size sz = (size) S;
+			uint8_t reg = this->fetchw ();
+			trace ("mov %s", reg_name (reg));
+			trace (", ");
+			uint8_t reg2 = this->fetchw ();
+			uint32_t reg_val = read_reg_ind (sz, reg2);
+			set_reg (reg, reg_val);
+			break;
+		}
+		case VirtualMachine::RIndirectRegister:
+		{
+			const size sz = (size) S;
+			uint8_t reg = this->fetchw ();
+			uint8_t rval = this->fetchw ();
+			trace ("mov ");
+			write_reg_ind (sz, reg, rval);
+			break;
+		}
+		case VirtualMachine::RIndirectImmediate:
+		{
+			const size sz = (size) S;
+			uint8_t reg = this->fetchw ();
+			trace ("mov ");
+			write_reg_rind_val (sz, reg);
+
+			break;
+		}
+		case VirtualMachine::RIndirectIndirect:
+		{
+			const size sz = (size) S;
+			uint8_t reg = this->fetchw ();
+			uint32_t addr = this->fetchq ();
+			trace ("mov ");
+			write_reg_rind_val_ind (sz, reg, addr);
+
+			break;
+		}
+		case VirtualMachine::IndirectRegister:
+		{
+			const size sz = (size) S;
+			uint32_t addr = this->fetchq ();
+			uint8_t reg = this->fetchw ();
+
+			trace ("mov ");
+			write_reg (sz, addr, reg);
+
+			break;
+		}
+		case VirtualMachine::IndirectImmediate:
+		{
+			const size sz = (size) S;
+			uint32_t addr = this->fetchq ();
+			trace ("mov ");
+			write_val (sz, addr);
+
+			break;
+		}
+		case VirtualMachine::RegisterRegister:
+		{
+			const size sz = (size) S;
+			uint8_t reg = this->fetchw ();
+			uint8_t reg2 = this->fetchw ();
+			
+			trace ("mov ");
+			this->set_reg_reg (sz, reg, reg2);
+			break;
+		}
+		default:
+			fprintf (stderr, "mov %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+	}
+}
+
+void VirtualMachine::HLT () {
+	trace ("hlt");
+	this->status |= Halted;
+}
+
+template <int M, int S>
+void VirtualMachine::CMP () {
+	const addressing_mode mode = (addressing_mode) M;
+
+	set_reg (Flags, 0);
+
+	switch (mode) {
+		case VirtualMachine::Immediate:
+		case VirtualMachine::Register:
+		case VirtualMachine::Indirect:
+		case VirtualMachine::RIndirect:
+			fprintf (stderr, "cmp %s impossible\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+		case VirtualMachine::RegisterImmediate:
+		{
+			const size sz = (size) S;
+			uint8_t reg = this->fetchw ();
+			uint32_t reg_val = read_reg (reg);
+			trace ("cmp %s, ", reg_name (reg));
+			uint32_t val = read_val (sz);
+
+			int64_t reg_v = (int64_t) reg_val;
+			int64_t val_v = (int64_t) val;
+
+			if (reg_v - val_v == 0)
+				this->registers->Flags |= Zero;
+			if (reg_v - val_v < 0)
+				this->registers->Flags |= Underflow;
+			if (reg_v - val_v > UINT32_MAX)
+				this->registers->Flags |= Overflow;
+			if ((reg_v - val_v) % 2 == 0)
+				this->registers->Flags |= Parity;
+
+			break;
+		}
+		case VirtualMachine::RIndirectImmediate:
+		{
+			const size sz = (size) S;
+			uint8_t reg = this->fetchw ();
+			trace ("cmp %s", reg_name (reg));
+			uint32_t reg_val = read_reg_ind(sz, reg);
+			trace (", ");
+			uint32_t val = read_val (sz);
+
+			int64_t reg_v = (int64_t) reg_val;
+			int64_t val_v = (int64_t) val;
+
+			if (reg_v - val_v == 0)
+				this->registers->Flags |= Zero;
+			if (reg_v - val_v < 0)
+				this->registers->Flags |= Underflow;
+			if (reg_v - val_v > UINT32_MAX)
+				this->registers->Flags |= Overflow;
+			if ((reg_v - val_v) % 2 == 0)
+				this->registers->Flags |= Parity;
+
+			break;
+		}
+		case VirtualMachine::IndirectImmediate:
+		{
+			const size sz = (size) S;
+			trace ("cmp (");
+			uint32_t addr_a = read_val (qword);
+			trace ("), ");
+			uint32_t b = read_val (sz);
+			uint32_t a = this->read_val_n (sz, addr_a);
+
+			int64_t val_a = (int64_t) a;
+			int64_t val_b = (int64_t) b;
+
+			if (val_a - val_b == 0)
+				this->registers->Flags |= Zero;
+			if (val_a - val_b < 0)
+				this->registers->Flags |= Underflow;
+			if (val_a - val_b > UINT32_MAX)
+				this->registers->Flags |= Overflow;
+			if ((val_a - val_b) % 2 == 0)
+				this->registers->Flags |= Parity;
+
+			break;
+		}
+		default:
+			fprintf (stderr, "cmp %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+	}
+}
+
+template <int M, int S>
+void VirtualMachine::JMP () {
+	const addressing_mode mode = (addressing_mode) M;
+
+	switch (mode) {
+		case VirtualMachine::Immediate:
+		{
+			uint32_t val = this->fetchq ();
+			this->registers->PC = val;
+			trace ("jmp $%08X", val);
+			break;
+		}
+		case VirtualMachine::Register:
+			fprintf (stderr, "jmp %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+		case VirtualMachine::Indirect:
+			fprintf (stderr, "jmp %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+		case VirtualMachine::RIndirect:
+			fprintf (stderr, "jmp %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+		default:
+			fprintf (stderr, "jmp %s impossible\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+	}
+}
+
+template <int M, int S>
+void VirtualMachine::JE () {
+	const addressing_mode mode = (addressing_mode) M;
+
+	switch (mode) {
+		case VirtualMachine::Immediate:
+		{
+			uint32_t val = this->fetchq ();
+			if (this->registers->Flags & Zero)
+				this->registers->PC = val;
+			trace ("je $%08X", val);
+			break;
+		}
+		case VirtualMachine::Register:
+			fprintf (stderr, "je %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+		case VirtualMachine::Indirect:
+			fprintf (stderr, "je %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+		case VirtualMachine::RIndirect:
+			fprintf (stderr, "je %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+		default:
+			fprintf (stderr, "je %s impossible\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+	}
+}
+
+template <int M, int S>
+void VirtualMachine::JL () {
+	const addressing_mode mode = (addressing_mode) M;
+
+	switch (mode) {
+		case VirtualMachine::Immediate:
+		{
+			uint32_t val = this->fetchq ();
+			if (this->registers->Flags & Underflow)
+				this->registers->PC = val;
+			trace ("jl $%08X", val);
+			break;
+		}
+		case VirtualMachine::Register:
+			fprintf (stderr, "jl %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+		case VirtualMachine::Indirect:
+			fprintf (stderr, "jl %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+		case VirtualMachine::RIndirect:
+			fprintf (stderr, "jl %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+		default:
+			fprintf (stderr, "jl %s impossible\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+	}
+}
+
+template <int M, int S>
+void VirtualMachine::JNE () {
+	const addressing_mode mode = (addressing_mode) M;
+
+	switch (mode) {
+		case VirtualMachine::Immediate:
+		{
+			uint32_t val = this->fetchq ();
+			if (!(this->registers->Flags & Zero))
+				this->registers->PC = val;
+			trace ("jne $%08X", val);
+			break;
+		}
+		case VirtualMachine::Register:
+			fprintf (stderr, "jne %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+		case VirtualMachine::Indirect:
+			fprintf (stderr, "jne %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+		case VirtualMachine::RIndirect:
+			fprintf (stderr, "jne %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+		default:
+			fprintf (stderr, "jne %s impossible\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+	}
+}
+
+template <int M, int S>
+void VirtualMachine::XOR () {
+	const addressing_mode mode = (addressing_mode) M;
+
+	switch (mode) {
+		case VirtualMachine::Register:
+		{
+			uint8_t reg = this->fetchw ();
+			trace ("xor %s", reg_name(reg));
+			set_reg (reg, 0);
+			break;
+		}
+		case VirtualMachine::RegisterImmediate:
+		case VirtualMachine::RegisterRegister:
+		case VirtualMachine::RegisterIndirect:
+		case VirtualMachine::RegisterRindirect:
+		case VirtualMachine::IndirectImmediate:
+		case VirtualMachine::IndirectRegister:
+		case VirtualMachine::IndirectIndirect:
+		case VirtualMachine::IndirectRIndirect:
+		case VirtualMachine::RIndirectImmediate:
+		case VirtualMachine::RIndirectRegister:
+		case VirtualMachine::RIndirectIndirect:
+		case VirtualMachine::RIndirectRIndirect:
+		case VirtualMachine::Indirect:
+		case VirtualMachine::RIndirect:
+			fprintf (stderr, "xor %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+		default:
+			fprintf (stderr, "xor %s impossible\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+	}
+}
+
+template <int M, int S>
+void VirtualMachine::OR () {
+	const addressing_mode mode = (addressing_mode) M;
+
+	switch (mode) {
+		case VirtualMachine::RegisterImmediate:
+		{
+			const size sz = (size) S;
+			uint8_t reg = this->fetchw ();
+			uint32_t reg_val = read_reg (reg);
+			trace ("or %s, ", reg_name (reg));
+			uint32_t val = read_val (sz);
+
+			set_reg (reg, reg_val | val);
+
+			break;
+		}
+		case VirtualMachine::RegisterRegister:
+		case VirtualMachine::RegisterIndirect:
+		case VirtualMachine::RegisterRindirect:
+		case VirtualMachine::IndirectImmediate:
+		case VirtualMachine::IndirectRegister:
+		case VirtualMachine::IndirectIndirect:
+		case VirtualMachine::IndirectRIndirect:
+		case VirtualMachine::RIndirectImmediate:
+		case VirtualMachine::RIndirectRegister:
+		case VirtualMachine::RIndirectIndirect:
+		case VirtualMachine::RIndirectRIndirect:
+			fprintf (stderr, "or %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+		default:
+			fprintf (stderr, "or %s impossible\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+	}
+}
+
+template <int M, int S>
+void VirtualMachine::INC () {
+	const addressing_mode mode = (addressing_mode) M;
+
+	switch (mode) {
+		case VirtualMachine::Register:
+		{
+			uint8_t reg = this->fetchw ();
+			uint32_t reg_val = read_reg (reg);
+			trace ("inc %s", reg_name (reg));
+			set_reg (reg, reg_val + 1);
+			break;
+		}
+		case VirtualMachine::RegisterImmediate:
+		case VirtualMachine::RegisterRegister:
+		case VirtualMachine::RegisterIndirect:
+		case VirtualMachine::RegisterRindirect:
+		case VirtualMachine::IndirectImmediate:
+		case VirtualMachine::IndirectRegister:
+		case VirtualMachine::IndirectIndirect:
+		case VirtualMachine::IndirectRIndirect:
+		case VirtualMachine::RIndirectImmediate:
+		case VirtualMachine::RIndirectRegister:
+		case VirtualMachine::RIndirectIndirect:
+		case VirtualMachine::RIndirectRIndirect:
+		case VirtualMachine::Indirect:
+		case VirtualMachine::RIndirect:
+			fprintf (stderr, "inc %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+		default:
+			fprintf (stderr, "inc %s impossible\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+	}
+}
+
+template <int M, int S>
+void VirtualMachine::SHL () {
+	const addressing_mode mode = (addressing_mode) M;
+
+	switch (mode) {
+		case VirtualMachine::RegisterImmediate:
+		{
+			uint8_t reg = this->fetchw ();
+			uint32_t reg_val = read_reg (reg);
+			trace ("shl %s, ", reg_name (reg));
+			uint32_t amm = this->fetchw ();
+
+			set_reg (reg, reg_val << amm);
+
+			break;
+		}
+		case VirtualMachine::RegisterRegister:
+		case VirtualMachine::RegisterIndirect:
+		case VirtualMachine::RegisterRindirect:
+		case VirtualMachine::IndirectImmediate:
+		case VirtualMachine::IndirectRegister:
+		case VirtualMachine::IndirectIndirect:
+		case VirtualMachine::IndirectRIndirect:
+		case VirtualMachine::RIndirectImmediate:
+		case VirtualMachine::RIndirectRegister:
+		case VirtualMachine::RIndirectIndirect:
+		case VirtualMachine::RIndirectRIndirect:
+			fprintf (stderr, "shl %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+		default:
+			fprintf (stderr, "shl %s impossible\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+	}
+}
+
+template <int M, int S>
+void VirtualMachine::CALL () {
+	const addressing_mode mode = (addressing_mode) M;
+
+	switch (mode) {
+		case VirtualMachine::ImmediateImmediate:
+		case VirtualMachine::ImmediateRegister:
+		case VirtualMachine::ImmediateIndirect:
+		case VirtualMachine::ImmediateRindirect:
+		case VirtualMachine::RegisterImmediate:
+		case VirtualMachine::RegisterRegister:
+		case VirtualMachine::RegisterIndirect:
+		case VirtualMachine::RegisterRindirect:
+		case VirtualMachine::IndirectImmediate:
+		case VirtualMachine::IndirectRegister:
+		case VirtualMachine::IndirectIndirect:
+		case VirtualMachine::IndirectRIndirect:
+		case VirtualMachine::RIndirectImmediate:
+		case VirtualMachine::RIndirectRegister:
+		case VirtualMachine::RIndirectIndirect:
+		case VirtualMachine::RIndirectRIndirect:
+			fprintf (stderr, "call %s impossible\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+		case VirtualMachine::Immediate:
+		{
+			uint32_t addr = this->fetchq ();
+			this->pushq (this->registers->PC);
+			trace ("call %08X", addr);
+			this->registers->PC = addr;
+			break;
+		}
+		default:
+			fprintf (stderr, "call %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+	}
+}
+
+template <int M, int S>
+void VirtualMachine::CALLE () {
+	const addressing_mode mode = (addressing_mode) M;
+
+	switch (mode) {
+		case VirtualMachine::ImmediateImmediate:
+		case VirtualMachine::ImmediateRegister:
+		case VirtualMachine::ImmediateIndirect:
+		case VirtualMachine::ImmediateRindirect:
+		case VirtualMachine::RegisterImmediate:
+		case VirtualMachine::RegisterRegister:
+		case VirtualMachine::RegisterIndirect:
+		case VirtualMachine::RegisterRindirect:
+		case VirtualMachine::IndirectImmediate:
+		case VirtualMachine::IndirectRegister:
+		case VirtualMachine::IndirectIndirect:
+		case VirtualMachine::IndirectRIndirect:
+		case VirtualMachine::RIndirectImmediate:
+		case VirtualMachine::RIndirectRegister:
+		case VirtualMachine::RIndirectIndirect:
+		case VirtualMachine::RIndirectRIndirect:
+			fprintf (stderr, "calle %s impossible\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+		case VirtualMachine::Immediate:
+		{
+			uint32_t addr = this->fetchq ();
+			trace ("calle %08X", addr);
+			if (this->registers->Flags & Zero) {
+				this->pushq (this->registers->PC);
+				this->registers->PC = addr;
+			}
+			break;
+		}
+		default:
+			fprintf (stderr, "calle %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+	}
+}
+
+template <int M, int S>
+void VirtualMachine::MUL () {
+	const addressing_mode mode = (addressing_mode) M;
+
+	switch (mode) {
+		case VirtualMachine::RegisterImmediate:
+		{
+			const size sz = (size) S;
+			uint8_t reg = this->fetchw ();
+			uint32_t reg_val = read_reg (reg);
+			trace ("mul %s, ", this->reg_name (reg));
+			uint32_t val = this->read_val (sz);
+			
+			this->set_reg (reg, reg_val * val);
+
+			break;
+		}
+		default:
+			fprintf (stderr, "mul %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+	}
+}
+
+template <int M, int S>
+void VirtualMachine::ADD () {
+	const addressing_mode mode = (addressing_mode) M;
+
+	switch (mode) {
+		case VirtualMachine::RegisterRegister:
+		{
+			uint8_t a = this->fetchw ();
+			uint32_t a_val = read_reg (a);
+			uint8_t b = this->fetchw ();
+			uint32_t b_val = read_reg (b);
+			trace ("add %s, %s", this->reg_name (a), this->reg_name (b));
+
+			this->set_reg (a, a_val + b_val);
+
+			break;
+		}
+		case VirtualMachine::RegisterImmediate:
+		{
+			const size sz = (size) S;
+			uint8_t a = this->fetchw ();
+			uint32_t a_val = read_reg (a);
+			trace ("add %s, ", this->reg_name (a));
+			uint32_t val = this->read_val (sz);
+
+			this->set_reg (a, a_val + val);
+
+			break;
+		}
+		default:
+			fprintf (stderr, "add %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+	}
+}
+
+void VirtualMachine::RET () {
+	this->registers->PC = this->popq ();
+	trace ("ret");
+}
+
+template <int M, int S>
+void VirtualMachine::LDIDT () {
+	const addressing_mode mode = (addressing_mode) M;
+
+	switch (mode) {
+		case VirtualMachine::ImmediateImmediate:
+		case VirtualMachine::ImmediateRegister:
+		case VirtualMachine::ImmediateIndirect:
+		case VirtualMachine::ImmediateRindirect:
+		case VirtualMachine::RegisterImmediate:
+		case VirtualMachine::RegisterRegister:
+		case VirtualMachine::RegisterIndirect:
+		case VirtualMachine::RegisterRindirect:
+		case VirtualMachine::IndirectImmediate:
+		case VirtualMachine::IndirectRegister:
+		case VirtualMachine::IndirectIndirect:
+		case VirtualMachine::IndirectRIndirect:
+		case VirtualMachine::RIndirectImmediate:
+		case VirtualMachine::RIndirectRegister:
+		case VirtualMachine::RIndirectIndirect:
+		case VirtualMachine::RIndirectRIndirect:
+			fprintf (stderr, "ldidt %s impossible\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+		case VirtualMachine::Immediate:
+		{
+			uint32_t addr = this->fetchq ();
+			trace ("ldidt %08X", addr);
+			this->idt = addr;
+			break;
+		}
+		default:
+			fprintf (stderr, "ldidt %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+	}
+}
+
+// insb $port, reg: sends C bytes starting at the address in reg to port,
+// then advances reg past them and clears C
+template <int M, int S>
+void VirtualMachine::INSB () {
+	const addressing_mode mode = (addressing_mode) M;
+
+	switch (mode) {
+		case VirtualMachine::ImmediateRegister:
+		{
+			uint8_t port = this->fetchw ();
+			uint8_t reg = this->fetchw ();
+			uint32_t addr = this->read_reg (reg);
+			uint32_t count = this->read_reg (C);
+
+			trace ("insb $%02X, %s($%08X), %u", port, this->reg_name (reg), addr, count);
+
+			this->minsb (port, addr, count);
+			this->set_reg (reg, addr + count);
+			this->set_reg (C, 0);
+			break;
+		}
+		default:
+			fprintf (stderr, "insb %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+	}
+}
+
+// outsb reg, $port: reads C bytes from port into memory at the address in
+// reg, then advances reg past them and clears C
+template <int M, int S>
+void VirtualMachine::OUTSB () {
+	const addressing_mode mode = (addressing_mode) M;
+
+	switch (mode) {
+		case VirtualMachine::RegisterImmediate:
+		{
+			uint8_t reg = this->fetchw ();
+			uint8_t port = this->fetchw ();
+			uint32_t addr = this->read_reg (reg);
+			uint32_t count = this->read_reg (C);
+
+			trace ("outsb %s($%08X), $%02X, %u", this->reg_name (reg), addr, port, count);
+
+			this->moutsb (port, addr, count);
+			this->set_reg (reg, addr + count);
+			this->set_reg (C, 0);
+			break;
+		}
+		default:
+			fprintf (stderr, "outsb %s unimplemented\n", addressing_name (mode));
+			this->status = Halted | Fault;
+			break;
+	}
+}
+
+void VirtualMachine::IRET () {
+	this->status = this->popq ();
+	this->registers->PC = this->popq ();
+	if (this->pic->IsAutoEOI ())
+		this->pic->EOI ();
+	trace ("iret");
+}
+
+void VirtualMachine::PUSHA () {
+	this->mpusha ();
+}
+
+void VirtualMachine::POPA () {
+	this->mpopa ();
+}
+
+void VirtualMachine::interrupt (uint8_t line) {
+	this->pic->Raise (line);
+}
+
+bool VirtualMachine::InterruptReady () const {
+	return this->interrupts_enabled && this->pic->Next () >= 0;
+}
+
+void VirtualMachine::Wake () {
+	std::lock_guard<std::mutex> guard (this->wake_lock);
+	this->woken.notify_all ();
+	if (this->timer != nullptr) {
+		this->parked = false;
+		this->timer->Resume ();
+	}
+	if (this->Wakeup != nullptr)
+		this->Wakeup ();
+}
+
+void VirtualMachine::Park () {
+	std::unique_lock<std::mutex> guard (this->wake_lock);
+	this->parked = true;
+	this->woken.wait (guard, [this] { return !(this->status & Halted) || this->status == Off || this->InterruptReady (); });
+	this->parked = false;
+}
+
+void VirtualMachine::Start (char *path, run_mode mode) {
+	for (Hardware *hw : this->hardware)
+		hw->Start ();
+
+	this->status |= On;
+
+	for (int i = 0; i < 16; i++)
+		this->memory->writeq (0xA0000 + (i * 4), colors[i]);
+
+	std::ifstream input (path, std::ios::binary);
+	std::vector<char> data ((std::istreambuf_iterator<char> (input)),
+	(std::istreambuf_iterator<char> ()));
+
+	for (size_t s = 0; s < data.size (); s++)
+		this->memory->writew (s, data[s]);
+
+	if (mode == Throttled) {
+		this->timer = new Timer (1024000);
+		this->timer->Tick = [&] (uint64_t delta, uint64_t total) {
+			this->RunSlice (1);
+
+			if (this->status == Off)
+				this->PowerOff ();
+
+			// Nothing to run until an interrupt arrives; Wake resumes the timer.
+			// parked goes up before the second look, as in Park, so a Raise
+			// either sees it or is seen here.
+			if (this->status & Halted && !this->InterruptReady ()) {
+				this->timer->Halt ();
+				this->parked = true;
+				if ((!(this->status & Halted) || this->InterruptReady ()) && this->parked.exchange (false))
+					this->timer->Resume ();
+			}
+		};
+		this->timer->Start ();
+		return;
+	}
+
+#if defined(VM_JIT) && !defined(VM_TRACE)
+	this->jit = new Jit (this);
+#endif
+	if (mode == FreeRunning)
+		this->thread = new std::thread (&VirtualMachine::Run, this);
+}
+
+int VirtualMachine::Step () {
+	decoded *entry = &this->decode_cache[this->registers->PC & (decode_cache_size - 1)];
+	if (entry->address != this->registers->PC)
+		entry = this->Decode (this->registers->PC);
+
+#ifdef VM_JIT
+	if (this->jit != nullptr && entry != &this->uncached) {
+		if (entry->block == nullptr && ++entry->hits == Jit::threshold)
+			entry->block = this->jit->Compile (this->registers->PC);
+		if (entry->block != nullptr)
+			return this->jit->Run (entry->block, this->registers);
+	}
+#endif
+
+	trace ("%08X: ", this->registers->PC);
+
+	this->fetch = entry;
+	this->fetch_base = this->registers->PC;
+	this->registers->PC += entry->header;
+	(this->*entry->handler) ();
+	trace ("\n");
+	return 1;
+}
+
+VirtualMachine::decoded *VirtualMachine::Decode (uint32_t address) {
+	if (!this->memory->IsRAM (address, max_instruction_length)) {
+		this->Resolve (&this->uncached, this->memory->readw (address), this->memory->readw (address + 1), this->memory->readw (address + 2));
+		return &this->uncached;
+	}
+
+	decoded *entry = &this->decode_cache[address & (decode_cache_size - 1)];
+	entry->address = address;
+	entry->window = max_instruction_length;
+	entry->block = nullptr;
+	entry->hits = 0;
+	memcpy (entry->bytes, this->memory->memory + address, max_instruction_length);
+	this->Resolve (entry, entry->bytes[0], entry->bytes[1], entry->bytes[2]);
+
+	this->memory->MarkCode (address, max_instruction_length);
+	return entry;
+}
+
+void VirtualMachine::Resolve (decoded *entry, uint8_t opcode, uint8_t mode, uint8_t sz) {
+	const opcode_info &info = this->opcodes[opcode];
+
+	if (info.handlers == nullptr) {
+		entry->handler = this->instructions[opcode];
+		entry->header = 1;
+	} else if (mode > RIndirect || (info.sized && sz > qword)) {
+		entry->handler = &VirtualMachine::invalid_encoding;
+		entry->header = 1;
+	} else {
+		entry->handler = (*info.handlers)[mode][info.sized ? (int) sz : (int) word];
+		entry->header = info.sized ? 3 : 2;
+	}
+}
+
+void VirtualMachine::InvalidateCode (uint32_t page) {
+	if (this->jit != nullptr)
+		this->jit->Invalidate (page);
+
+	// Only decodes starting up to a window before the page can overlap it,
+	// and each of those addresses has exactly one slot.
+	uint32_t first = page << GUEST_PAGE_SHIFT;
+	uint32_t start = first >= max_instruction_length - 1 ? first - (max_instruction_length - 1) : 0;
+	uint32_t end = first + GUEST_PAGE_SIZE;
+
+	for (uint32_t address = start; address != end; address++) {
+		decoded &entry = this->decode_cache[address & (decode_cache_size - 1)];
+		if (entry.address == address)
+			entry.address = invalid_address;
+	}
+}
+
+void VirtualMachine::Service () {
+	if (!this->interrupts_enabled)
+		return;
+
+	int line = this->pic->Acknowledge ();
+	if (line >= 0) {
+		if (this->status & Halted)
+			this->status ^= Halted;
+		this->pushq (this->registers->PC);
+		this->pushq (this->status);
+		this->registers->PC = this->memory->readq (this->idt + line * sizeof (int_desc));
+	}
+}
+
+void VirtualMachine::RunBatch (void *context) {
+	VirtualMachine *VM = (VirtualMachine *) context;
+	while (VM->executed < VM->budget && !(VM->status & Halted) && VM->status & On)
+		VM->executed += VM->Step ();
+
+	VM->Service ();
+}
+
+int VirtualMachine::RunSlice (int budget) {
+	this->budget = budget;
+	this->executed = 0;
+
+	if (!this->memory->Guard (&VirtualMachine::RunBatch, this)) {
+		trace ("memory fault at %08X\n", this->registers->PC);
+		this->status = Halted | Fault;
+	}
+
+	return this->executed;
+}
+
+void VirtualMachine::Run () {
+	while (this->status != Off) {
+		this->RunSlice (batch_size);
+
+		if (this->status & Halted)
+			this->Park ();
+	}
+
+	this->PowerOff ();
+}
+
+void VirtualMachine::PowerOff () {
+	for (Hardware *hw : this->hardware)
+		hw->Stop ();
+	this->status |= Halted;
+}
+
+void VirtualMachine::Shutdown () {
+	this->status = Off;
+
+	if (this->thread != nullptr) {
+		// Run powers off on its way out
+		this->Wake ();
+		this->thread->join ();
+		delete this->thread;
+		this->thread = nullptr;
+	} else if (this->timer != nullptr) {
+		this->timer->Stop ();
+		if (this->status == Off)
+			this->PowerOff ();
+	} else
+		this->Wake ();
+}
+
+void VirtualMachine::pushw (uint8_t val) {
+	this->registers->SP--;
+	memory->writew (read_reg (SP), val);
+}
+void VirtualMachine::pushd (uint16_t val) {
+	this->registers->SP -= 2;
+	memory->writed (read_reg (SP), val);
+}
+void VirtualMachine::pushq (uint32_t val) {
+	this->registers->SP -= 4;
+	memory->writeq (read_reg (SP), val);
+}
+
+uint8_t VirtualMachine::popw () {
+	this->registers->SP++;
+	auto temp = memory->readw (read_reg (SP));
+	return temp;
+}
+uint16_t VirtualMachine::popd () {
+	this->registers->SP += 2;
+	auto temp = memory->readd (read_reg (SP));
+	return temp;
+}
+uint32_t VirtualMachine::popq () {
+	auto temp = memory->readq (read_reg (SP));
+	this->registers->SP += 4;
+	return temp;
+}
+
+void VirtualMachine::mpusha () {
+	this->pushq (this->registers->A.qword);
+	this->pushq (this->registers->B.qword);
+	this->pushq (this->registers->C.qword);
+	this->pushq (this->registers->D.qword);
+	this->pushq (this->registers->E.qword);
+	this->pushq (this->registers->F.qword);
+	this->pushq (this->registers->W.qword);
+	this->pushq (this->registers->X.qword);
+	this->pushq (this->registers->Y.qword);
+	this->pushq (this->registers->Z.qword);
+	this->pushd (this->registers->Flags);
+	this->pushd (this->registers->Clocks);
+	this->pushq (this->registers->CS);
+	this->pushq (this->registers->DS);
+	this->pushq (this->registers->SS);
+	this->pushq (this->registers->PC);
+	this->pushq (this->registers->SP);
+	this->pushq (this->registers->BP);
+}
+
+void VirtualMachine::mpopa () {
+	this->pushq (this->registers->BP);
+	this->pushq (this->registers->SP);
+	this->pushq (this->registers->PC);
+	this->pushq (this->registers->SS);
+	this->pushq (this->registers->DS);
+	this->pushq (this->registers->CS);
+	this->pushd (this->registers->Clocks);
+	this->pushd (this->registers->Flags);
+	this->pushq (this->registers->Z.qword);
+	this->pushq (this->registers->Y.qword);
+	this->pushq (this->registers->X.qword);
+	this->pushq (this->registers->W.qword);
+	this->pushq (this->registers->F.qword);
+	this->pushq (this->registers->E.qword);
+	this->pushq (this->registers->D.qword);
+	this->pushq (this->registers->C.qword);
+	this->pushq (this->registers->B.qword);
+	this->pushq (this->registers->A.qword);
+}
+
+uint32_t VirtualMachine::read_reg (uint8_t reg) {
+	registers_enum reg_enum = (registers_enum) reg;
+
+	switch (reg_enum) {
+		case VirtualMachine::A:
+			return this->registers->A.qword;
+		case VirtualMachine::AH:
+			return this->registers->A.dword.H;
+		case VirtualMachine::AL:
+			return this->registers->A.dword.L;
+		case VirtualMachine::AHH:
+			return this->registers->A.word.HH;
+		case VirtualMachine::AHL:
+			return this->registers->A.word.HL;
+		case VirtualMachine::ALH:
+			return this->registers->A.word.LH;
+		case VirtualMachine::ALL:
+			return this->registers->A.word.LL;
+		case VirtualMachine::B:
+			return this->registers->B.qword;
+		case VirtualMachine::BH:
+			return this->registers->B.dword.H;
+		case VirtualMachine::BL:
+			return this->registers->B.dword.L;
+		case VirtualMachine::BHH:
+			return this->registers->B.word.HH;
+		case VirtualMachine::BHL:
+			return this->registers->B.word.HL;
+		case VirtualMachine::BLH:
+			return this->registers->B.word.LH;
+		case VirtualMachine::BLL:
+			return this->registers->B.word.LL;
+		case VirtualMachine::C:
+			return this->registers->C.qword;
+		case VirtualMachine::CH:
+			return this->registers->C.dword.H;
+		case VirtualMachine::CL:
+			return this->registers->C.dword.L;
+		case VirtualMachine::CHH:
+			return this->registers->C.word.HH;
+		case VirtualMachine::CHL:
+			return this->registers->C.word.HL;
+		case VirtualMachine::CLH:
+			return this->registers->C.word.LH;
+		case VirtualMachine::CLL:
+			return this->registers->C.word.LL;
+		case VirtualMachine::D:
+			return this->registers->D.qword;
+		case VirtualMachine::DH:
+			return this->registers->D.dword.H;
+		case VirtualMachine::DL:
+			return this->registers->D.dword.L;
+		case VirtualMachine::DHH:
+			return this->registers->D.word.HH;
+		case VirtualMachine::DHL:
+			return this->registers->D.word.HL;
+		case VirtualMachine::DLH:
+			return this->registers->D.word.LH;
+		case VirtualMachine::DLL:
+			return this->registers->D.word.LL;
+		case VirtualMachine::E:
+			return this->registers->E.qword;
+		case VirtualMachine::EH:
+			return this->registers->E.dword.H;
+		case VirtualMachine::EL:
+			return this->registers->E.dword.L;
+		case VirtualMachine::EHH:
+			return this->registers->E.word.HH;
+		case VirtualMachine::EHL:
+			return this->registers->E.word.HL;
+		case VirtualMachine::ELH:
+			return this->registers->E.word.LH;
+		case VirtualMachine::ELL:
+			return this->registers->E.word.LL;
+		case VirtualMachine::F:
+			return this->registers->F.qword;
+		case VirtualMachine::FH:
+			return this->registers->F.dword.H;
+		case VirtualMachine::FL:
+			return this->registers->F.dword.L;
+		case VirtualMachine::FHH:
+			return this->registers->F.word.HH;
+		case VirtualMachine::FHL:
+			return this->registers->F.word.HL;
+		case VirtualMachine::FLH:
+			return this->registers->F.word.LH;
+		case VirtualMachine::FLL:
+			return this->registers->F.word.LL;
+		case VirtualMachine::W:
+			return this->registers->W.qword;
+		case VirtualMachine::WH:
+			return this->registers->W.dword.H;
+		case VirtualMachine::WL:
+			return this->registers->W.dword.L;
+		case VirtualMachine::WHH:
+			return this->registers->W.word.HH;
+		case VirtualMachine::WHL:
+			return this->registers->W.word.HL;
+		case VirtualMachine::WLH:
+			return this->registers->W.word.LH;
+		case VirtualMachine::WLL:
+			return this->registers->W.word.LL;
+		case VirtualMachine::X:
+			return this->registers->X.qword;
+		case VirtualMachine::XH:
+			return this->registers->X.dword.H;
+		case VirtualMachine::XL:
+			return this->registers->X.dword.L;
+		case VirtualMachine::XHH:
+			return this->registers->X.word.HH;
+		case VirtualMachine::XHL:
+			return this->registers->X.word.HL;
+		case VirtualMachine::XLH:
+			return this->registers->X.word.LH;
+		case VirtualMachine::XLL:
+			return this->registers->X.word.LL;
+		case VirtualMachine::Y:
+			return this->registers->Y.qword;
+		case VirtualMachine::YH:
+			return this->registers->Y.dword.H;
+		case VirtualMachine::YL:
+			return this->registers->Y.dword.L;
+		case VirtualMachine::YHH:
+			return this->registers->Y.word.HH;
+		case VirtualMachine::YHL:
+			return this->registers->Y.word.HL;
+		case VirtualMachine::YLH:
+			return this->registers->Y.word.LH;
+		case VirtualMachine::YLL:
+			return this->registers->Y.word.LL;
+		case VirtualMachine::Z:
+			return this->registers->Z.qword;
+		case VirtualMachine::ZH:
+			return this->registers->Z.dword.H;
+		case VirtualMachine::ZL:
+			return this->registers->Z.dword.L;
+		case VirtualMachine::ZHH:
+			return this->registers->Z.word.HH;
+		case VirtualMachine::ZHL:
+			return this->registers->Z.word.HL;
+		case VirtualMachine::ZLH:
+			return this->registers->Z.word.LH;
+		case VirtualMachine::ZLL:
+			return this->registers->Z.word.LL;
+		case VirtualMachine::Flags:
+			return this->registers->Flags;
+		case VirtualMachine::Clocks:
+			return this->registers->Clocks;
+		case VirtualMachine::CS:
+			return this->registers->CS;
+		case VirtualMachine::DS:
+			return this->registers->DS;
+		case VirtualMachine::SS:
+			return this->registers->SS;
+		case VirtualMachine::PC:
+			return this->registers->PC;
+		case VirtualMachine::SP:
+			return this->registers->SP;
+		case VirtualMachine::BP:
+			return this->registers->BP;
+	}
+}
+
+void VirtualMachine::set_reg (uint8_t reg, uint32_t val) {
+	registers_enum renum = (registers_enum) reg;
+
+	switch (renum) {
+		case VirtualMachine::A:
+			this->registers->A.qword = val;
+			break;
+		case VirtualMachine::AH:
+			this->registers->A.dword.H = val;
+			break;
+		case VirtualMachine::AL:
+			this->registers->A.dword.L = val;
+			break;
+		case VirtualMachine::AHH:
+			this->registers->A.word.HH = val;
+			break;
+		case VirtualMachine::AHL:
+			this->registers->A.word.HL = val;
+			break;
+		case VirtualMachine::ALH:
+			this->registers->A.word.LH = val;
+			break;
+		case VirtualMachine::ALL:
+			this->registers->A.word.LL = val;
+			break;
+		case VirtualMachine::B:
+			this->registers->B.qword = val;
+			break;
+		case VirtualMachine::BH:
+			this->registers->B.dword.H = val;
+			break;
+		case VirtualMachine::BL:
+			this->registers->B.dword.L = val;
+			break;
+		case VirtualMachine::BHH:
+			this->registers->B.word.HH = val;
+			break;
+		case VirtualMachine::BHL:
+			this->registers->B.word.HL = val;
+			break;
+		case VirtualMachine::BLH:
+			this->registers->B.word.LH = val;
+			break;
+		case VirtualMachine::BLL:
+			this->registers->B.word.LL = val;
+			break;
+		case VirtualMachine::C:
+			this->registers->C.qword = val;
+			break;
+		case VirtualMachine::CH:
+			this->registers->C.dword.H = val;
+			break;
+		case VirtualMachine::CL:
+			this->registers->C.dword.L = val;
+			break;
+		case VirtualMachine::CHH:
+			this->registers->C.word.HH = val;
+			break;
+		case VirtualMachine::CHL:
+			this->registers->C.word.HL = val;
+			break;
+		case VirtualMachine::CLH:
+			this->registers->C.word.LH = val;
+			break;
+		case VirtualMachine::CLL:
+			this->registers->C.word.LL = val;
+			break;
+		case VirtualMachine::D:
+			this->registers->D.qword = val;
+			break;
+		case VirtualMachine::DH:
+			this->registers->D.dword.H = val;
+			break;
+		case VirtualMachine::DL:
+			this->registers->D.dword.L = val;
+			break;
+		case VirtualMachine::DHH:
+			this->registers->D.word.HH = val;
+			break;
+		case VirtualMachine::DHL:
+			this->registers->D.word.HL = val;
+			break;
+		case VirtualMachine::DLH:
+			this->registers->D.word.LH = val;
+			break;
+		case VirtualMachine::DLL:
+			this->registers->D.word.LL = val;
+			break;
+		case VirtualMachine::E:
+			this->registers->E.qword = val;
+			break;
+		case VirtualMachine::EH:
+			this->registers->E.dword.H = val;
+			break;
+		case VirtualMachine::EL:
+			this->registers->E.dword.L = val;
+			break;
+		case VirtualMachine::EHH:
+			this->registers->E.word.HH = val;
+			break;
+		case VirtualMachine::EHL:
+			this->registers->E.word.HL = val;
+			break;
+		case VirtualMachine::ELH:
+			this->registers->E.word.LH = val;
+			break;
+		case VirtualMachine::ELL:
+			this->registers->E.word.LL = val;
+			break;
+		case VirtualMachine::F:
+			this->registers->F.qword = val;
+			break;
+		case VirtualMachine::FH:
+			this->registers->F.dword.H = val;
+			break;
+		case VirtualMachine::FL:
+			this->registers->F.dword.L = val;
+			break;
+		case VirtualMachine::FHH:
+			this->registers->F.word.HH = val;
+			break;
+		case VirtualMachine::FHL:
+			this->registers->F.word.HL = val;
+			break;
+		case VirtualMachine::FLH:
+			this->registers->F.word.LH = val;
+			break;
+		case VirtualMachine::FLL:
+			this->registers->F.word.LL = val;
+			break;
+		case VirtualMachine::W:
+			this->registers->W.qword = val;
+			break;
+		case VirtualMachine::WH:
+			this->registers->W.dword.H = val;
+			break;
+		case VirtualMachine::WL:
+			this->registers->W.dword.L = val;
+			break;
+		case VirtualMachine::WHH:
+			this->registers->W.word.HH = val;
+			break;
+		case VirtualMachine::WHL:
+			this->registers->W.word.HL = val;
+			break;
+		case VirtualMachine::WLH:
+			this->registers->W.word.LH = val;
+			break;
+		case VirtualMachine::WLL:
+			this->registers->W.word.LL = val;
+			break;
+		case VirtualMachine::X:
+			this->registers->X.qword = val;
+			break;
+		case VirtualMachine::XH:
+			this->registers->X.dword.H = val;
+			break;
+		case VirtualMachine::XL:
+			this->registers->X.dword.L = val;
+			break;
+		case VirtualMachine::XHH:
+			this->registers->X.word.HH = val;
+			break;
+		case VirtualMachine::XHL:
+			this->registers->X.word.HL = val;
+			break;
+		case VirtualMachine::XLH:
+			this->registers->X.word.LH = val;
+			break;
+		case VirtualMachine::XLL:
+			this->registers->X.word.LL = val;
+			break;
+		case VirtualMachine::Y:
+			this->registers->Y.qword = val;
+			break;
+		case VirtualMachine::YH:
+			this->registers->Y.dword.H = val;
+			break;
+		case VirtualMachine::YL:
+			this->registers->Y.dword.L = val;
+			break;
+		case VirtualMachine::YHH:
+			this->registers->Y.word.HH = val;
+			break;
+		case VirtualMachine::YHL:
+			this->registers->Y.word.HL = val;
+			break;
+		case VirtualMachine::YLH:
+			this->registers->Y.word.LH = val;
+			break;
+		case VirtualMachine::YLL:
+			this->registers->Y.word.LL = val;
+			break;
+		case VirtualMachine::Z:
+			this->registers->Z.qword = val;
+			break;
+		case VirtualMachine::ZH:
+			this->registers->Z.dword.H = val;
+			break;
+		case VirtualMachine::ZL:
+			this->registers->Z.dword.L = val;
+			break;
+		case VirtualMachine::ZHH:
+			this->registers->Z.word.HH = val;
+			break;
+		case VirtualMachine::ZHL:
+			this->registers->Z.word.HL = val;
+			break;
+		case VirtualMachine::ZLH:
+			this->registers->Z.word.LH = val;
+			break;
+		case VirtualMachine::ZLL:
+			this->registers->Z.word.LL = val;
+			break;
+		case VirtualMachine::Flags:
+			this->registers->Flags = val;
+			break;
+		case VirtualMachine::Clocks:
+			this->registers->Clocks = val;
+			break;
+		case VirtualMachine::CS:
+			this->registers->CS = val;
+			break;
+		case VirtualMachine::DS:
+			this->registers->DS = val;
+			break;
+		case VirtualMachine::SS:
+			this->registers->SS = val;
+			break;
+		case VirtualMachine::PC:
+			this->registers->PC = val;
+			break;
+		case VirtualMachine::SP:
+			this->registers->SP = val;
+			break;
+		case VirtualMachine::BP:
+			this->registers->BP = val;
+			break;
+	}
+}
+
+const char *VirtualMachine::reg_name (uint8_t reg) {
+	registers_enum rege = (registers_enum) reg;
+
+	switch (rege) {
+		case VirtualMachine::A:
+			return "A";
+		case VirtualMachine::AH:
+			return "AH";
+		case VirtualMachine::AL:
+			return "AL";
+		case VirtualMachine::AHH:
+			return "AHH";
+		case VirtualMachine::AHL:
+			return "AHL";
+		case VirtualMachine::ALH:
+			return "ALH";
+		case VirtualMachine::ALL:
+			return "ALL";
+		case VirtualMachine::B:
+			return "B";
+		case VirtualMachine::BH:
+			return "BH";
+		case VirtualMachine::BL:
+			return "BL";
+		case VirtualMachine::BHH:
+			return "BHH";
+		case VirtualMachine::BHL:
+			return "BHL";
+		case VirtualMachine::BLH:
+			return "BLH";
+		case VirtualMachine::BLL:
+			return "BLL";
+		case VirtualMachine::C:
+			return "C";
+		case VirtualMachine::CH:
+			return "CH";
+		case VirtualMachine::CL:
+			return "CL";
+		case VirtualMachine::CHH:
+			return "CHH";
+		case VirtualMachine::CHL:
+			return "CHL";
+		case VirtualMachine::CLH:
+			return "CLH";
+		case VirtualMachine::CLL:
+			return "CLL";
+		case VirtualMachine::D:
+			return "D";
+		case VirtualMachine::DH:
+			return "DH";
+		case VirtualMachine::DL:
+			return "DL";
+		case VirtualMachine::DHH:
+			return "DHH";
+		case VirtualMachine::DHL:
+			return "DHL";
+		case VirtualMachine::DLH:
+			return "DLH";
+		case VirtualMachine::DLL:
+			return "DLL";
+		case VirtualMachine::E:
+			return "E";
+		case VirtualMachine::EH:
+			return "EH";
+		case VirtualMachine::EL:
+			return "EL";
+		case VirtualMachine::EHH:
+			return "EHH";
+		case VirtualMachine::EHL:
+			return "EHL";
+		case VirtualMachine::ELH:
+			return "ELH";
+		case VirtualMachine::ELL:
+			return "ELL";
+		case VirtualMachine::F:
+			return "F";
+		case VirtualMachine::FH:
+			return "FH";
+		case VirtualMachine::FL:
+			return "FL";
+		case VirtualMachine::FHH:
+			return "FHH";
+		case VirtualMachine::FHL:
+			return "FHL";
+		case VirtualMachine::FLH:
+			return "FLH";
+		case VirtualMachine::FLL:
+			return "FLL";
+		case VirtualMachine::W:
+			return "W";
+		case VirtualMachine::WH:
+			return "WH";
+		case VirtualMachine::WL:
+			return "WL";
+		case VirtualMachine::WHH:
+			return "WHH";
+		case VirtualMachine::WHL:
+			return "WHL";
+		case VirtualMachine::WLH:
+			return "WLH";
+		case VirtualMachine::WLL:
+			return "WLL";
+		case VirtualMachine::X:
+			return "X";
+		case VirtualMachine::XH:
+			return "XH";
+		case VirtualMachine::XL:
+			return "XL";
+		case VirtualMachine::XHH:
+			return "XHH";
+		case VirtualMachine::XHL:
+			return "XHL";
+		case VirtualMachine::XLH:
+			return "XLH";
+		case VirtualMachine::XLL:
+			return "XLL";
+		case VirtualMachine::Y:
+			return "Y";
+		case VirtualMachine::YH:
+			return "YH";
+		case VirtualMachine::YL:
+			return "YL";
+		case VirtualMachine::YHH:
+			return "YHH";
+		case VirtualMachine::YHL:
+			return "YHL";
+		case VirtualMachine::YLH:
+			return "YLH";
+		case VirtualMachine::YLL:
+			return "YLL";
+		case VirtualMachine::Z:
+			return "Z";
+		case VirtualMachine::ZH:
+			return "ZH";
+		case VirtualMachine::ZL:
+			return "ZL";
+		case VirtualMachine::ZHH:
+			return "ZHH";
+		case VirtualMachine::ZHL:
+			return "ZHL";
+		case VirtualMachine::ZLH:
+			return "ZLH";
+		case VirtualMachine::ZLL:
+			return "ZLL";
+		case VirtualMachine::Flags:
+			return "Flags";
+		case VirtualMachine::Clocks:
+			return "Clocks";
+		case VirtualMachine::CS:
+			return "CS";
+		case VirtualMachine::DS:
+			return "DS";
+		case VirtualMachine::SS:
+			return "SS";
+		case VirtualMachine::PC:
+			return "PC";
+		case VirtualMachine::SP:
+			return "SP";
+		case VirtualMachine::BP:
+			return "BP";
+	}
+}
+
+const char *VirtualMachine::addressing_name (addressing_mode mode) {
+	switch (mode) {
+		case VirtualMachine::ImmediateImmediate:
+			return "Immediate Immediate";
+		case VirtualMachine::ImmediateRegister:
+			return "Immediate Register";
+		case VirtualMachine::ImmediateIndirect:
+			return "Immediate Indirect";
+		case VirtualMachine::ImmediateRindirect:
+			return "Immediate RegisterIndirect";
+		case VirtualMachine::RegisterImmediate:
+			return "Register Immediate";
+		case VirtualMachine::RegisterRegister:
+			return "Register Register";
+		case VirtualMachine::RegisterIndirect:
+			return "Register Indirect";
+		case VirtualMachine::RegisterRindirect:
+			return "Register RegisterIndirect";
+		case VirtualMachine::IndirectImmediate:
+			return "Indirect Immediate";
+		case VirtualMachine::IndirectRegister:
+			return "Indirect Register";
+		case VirtualMachine::IndirectIndirect:
+			return "Indirect Indirect";
+		case VirtualMachine::IndirectRIndirect:
+			return "Indirect RegisterIndirect";
+		case VirtualMachine::RIndirectImmediate:
+			return "RegisterIndirect Immediate";
+		case VirtualMachine::RIndirectRegister:
+			return "RegisterIndirect Register";
+		case VirtualMachine::RIndirectIndirect:
+			return "RegisterIndirect Indirect";
+		case VirtualMachine::RIndirectRIndirect:
+			return "RegisterIndirect RegisterIndirect";
+		case VirtualMachine::Immediate:
+			return "Immediate";
+		case VirtualMachine::Register:
+			return "Register";
+		case VirtualMachine::Indirect:
+			return "Indirect";
+		case VirtualMachine::RIndirect:
+			return "RegisterIndirect";
+	}
+}
+
+uint32_t VirtualMachine::read_val_n (size sz, uint32_t addr) {
+	uint32_t val;
+	switch (sz) {
+		case VirtualMachine::word:
+			val = this->memory->readw (addr);
+			break;
+		case VirtualMachine::dword:
+			val = this->memory->readd (addr);
+			break;
+		case VirtualMachine::qword:
+			val = this->memory->readq (addr);
+			break;
+	}
+	return val;
+}
+
+uint32_t VirtualMachine::read_val (size sz) {
+	uint32_t val;
+	switch (sz) {
+		case VirtualMachine::word:
+			val = this->fetchw ();
+			trace ("$%02X", val);
+			break;
+		case VirtualMachine::dword:
+			val = this->fetchd ();
+			trace ("$%04X", val);
+			break;
+		case VirtualMachine::qword:
+			val = this->fetchq ();
+			trace ("$%08X", val);
+			break;
+	}
+	return val;
+}
+
+void VirtualMachine::write_val (size sz, uint32_t addr) {
+	uint32_t val;
+	switch (sz) {
+		case VirtualMachine::word:
+			trace ("($%08X), ", addr);
+			val = read_val (sz);
+			memory->writew (addr, val);
+			break;
+		case VirtualMachine::dword:
+			trace ("($%08X), ", addr);
+			val = read_val (sz);
+			memory->writed (addr, val);
+			break;
+		case VirtualMachine::qword:
+			trace ("($%08X), ", addr);
+			val = read_val (sz);
+			memory->writeq (addr, val);
+			break;
+	}
+}
+
+void VirtualMachine::write_reg (size sz, uint32_t addr, uint8_t reg) {
+	switch (sz) {
+		case VirtualMachine::word:
+		{
+			uint8_t val = read_reg (reg);
+			trace ("($%08X), %s", addr, reg_name (reg));
+			memory->writew (addr, val);
+			break;
+		}
+		case VirtualMachine::dword:
+		{
+			uint16_t val = read_reg (reg);
+			trace ("($%08X), %s", addr, reg_name (reg));
+			memory->writed (addr, val);
+			break;
+		}
+		case VirtualMachine::qword:
+		{
+			uint32_t val = read_reg (reg);
+			trace ("($%08X), %s", addr, reg_name (reg));
+			memory->writeq (addr, val);
+			break;
+		}
+	}
+}
+
+void VirtualMachine::write_reg_ind (size sz, uint8_t reg, uint8_t reg2) {
+	uint32_t addr = read_reg (reg);
+	
+	switch (sz) {
+		case VirtualMachine::word:
+		{
+			uint8_t val = read_reg (reg2);
+			trace ("(%s), %s", reg_name (reg), reg_name (reg2));
+			memory->writew (addr, val);
+			break;
+		}
+		case VirtualMachine::dword:
+		{
+			uint16_t val = read_reg (reg2);
+			trace ("(%s), %s", reg_name (reg), reg_name (reg2));
+			memory->writed (addr, val);
+			break;
+		}
+		case VirtualMachine::qword:
+		{
+			uint32_t val = read_reg (reg2);
+			trace ("(%s), %s", reg_name (reg), reg_name (reg2));
+			memory->writeq (addr, val);
+			break;
+		}
+	}
+}
+
+void VirtualMachine::set_reg_reg (size sz, uint8_t a, uint8_t b) {
+	switch (sz) {
+		case VirtualMachine::word:
+		{
+			uint32_t aval = read_reg (a);
+			uint8_t bval = read_reg (b);
+			trace ("%s, %s", reg_name (a), reg_name (b));
+			this->set_reg (a, (aval & 0xFFFFFF00) | bval);
+			break;
+		}
+		case VirtualMachine::dword:
+		{
+			uint32_t aval = read_reg (a);
+			uint16_t bval = read_reg (b);
+			trace ("%s, %s", reg_name (a), reg_name (b));
+			this->set_reg (a, (aval & 0xFFFF0000) | bval);
+			break;
+		}
+		case VirtualMachine::qword:
+		{
+			uint32_t aval = read_reg (a);
+			uint16_t bval = read_reg (b);
+			trace ("%s, %s", reg_name (a), reg_name (b));
+			this->set_reg (a, bval);
+			break;
+		}
+	}
+}
+
+void VirtualMachine::write_reg_rind_val (size sz, uint8_t reg) {
+	uint32_t addr = read_reg (reg);
+
+	switch (sz) {
+		case VirtualMachine::word:
+		{
+			trace ("(%s), ", reg_name (reg));
+			memory->writew (addr, read_val (sz));
+			break;
+		}
+		case VirtualMachine::dword:
+		{
+			trace ("(%s), ", reg_name (reg));
+			memory->writed (addr, read_val (sz));
+			break;
+		}
+		case VirtualMachine::qword:
+		{
+			trace ("(%s), ", reg_name (reg));
+			memory->writeq (addr, read_val (sz));
+			break;
+		}
+	}
+}
+
+void VirtualMachine::write_reg_rind_val_ind (size sz, uint8_t reg, uint32_t vaddr) {
+	uint32_t addr = read_reg (reg);
+
+	switch (sz) {
+		case VirtualMachine::word:
+		{
+			trace ("(%s), ($%02X)", reg_name (reg), vaddr);
+			memory->writew (addr, memory->readw (vaddr));
+			break;
+		}
+		case VirtualMachine::dword:
+		{
+			trace ("(%s), ($%04X)", reg_name (reg), vaddr);
+			memory->writed (addr, memory->readd (vaddr));
+			break;
+		}
+		case VirtualMachine::qword:
+		{
+			trace ("(%s), ($%08X)", reg_name (reg), vaddr);
+			memory->writeq (addr, memory->readq (vaddr));
+			break;
+		}
+	}
+}
+
+uint32_t VirtualMachine::read_reg_ind (size sz, uint8_t reg) {
+	uint32_t val;
+	switch (sz) {
+		case VirtualMachine::word:
+			val = memory->readw(read_reg (reg));
+			trace ("(%s)", reg_name (reg));
+			break;
+		case VirtualMachine::dword:
+			val = memory->readd (read_reg (reg));
+			trace ("(%s)", reg_name (reg));
+			break;
+		case VirtualMachine::qword:
+			val = memory->readq (read_reg (reg));
+			trace ("(%s)", reg_name (reg));
+			break;
+	}
+	return val;
+}
+
+void VirtualMachine::AddHardware (Hardware *hardware) {
+	this->hardware.push_back (hardware);
+}
+void VirtualMachine::AddMemoryRegion (MemoryRegion *region) {
+	this->memory->AddMemoryRegion (region);
+}
+
+void VirtualMachine::minb (uint8_t port, uint8_t value) {
+	this->inpb[port] (value);
+}
+void VirtualMachine::mind (uint8_t port, uint16_t value) {
+	this->inpd[port] (value);
+}
+void VirtualMachine::minq (uint8_t port, uint32_t value) {
+	this->inpq[port] (value);
+}
+
+uint8_t VirtualMachine::moutb (uint8_t port) {
+	return this->outpb[port] ();
+}
+uint16_t VirtualMachine::moutd (uint8_t port) {
+	return this->outpd[port] ();
+}
+uint32_t VirtualMachine::moutq (uint8_t port) {
+	return this->outpq[port] ();
+}
+
+void VirtualMachine::minsb (uint8_t port, uint32_t addr, uint32_t count) {
+	if (count == 0)
+		return;
+
+	if (this->memory->IsRAM (addr, count)) {
+		this->inpsb[port] (this->memory->memory + addr, count);
+		return;
+	}
+
+	// The range touches a memory region; bounce it through Memory in chunks
+	uint8_t buffer[256];
+	while (count > 0) {
+		uint32_t chunk = count < sizeof (buffer) ? count : sizeof (buffer);
+		for (uint32_t i = 0; i < chunk; i++)
+			buffer[i] = this->memory->readw (addr + i);
+		this->inpsb[port] (buffer, chunk);
+		addr += chunk;
+		count -= chunk;
+	}
+}
+void VirtualMachine::moutsb (uint8_t port, uint32_t addr, uint32_t count) {
+	if (count == 0)
+		return;
+
+	if (this->memory->IsRAM (addr, count)) {
+		this->outpsb[port] (this->memory->memory + addr, count);
+		this->memory->Written (addr, count);
+		return;
+	}
+
+	uint8_t buffer[256];
+	while (count > 0) {
+		uint32_t chunk = count < sizeof (buffer) ? count : sizeof (buffer);
+		this->outpsb[port] (buffer, chunk);
+		for (uint32_t i = 0; i < chunk; i++)
+			this->memory->writew (addr + i, buffer[i]);
+		addr += chunk;
+		count -= chunk;
+	}
+}
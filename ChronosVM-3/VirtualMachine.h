@@ -1,297 +1,447 @@
-#pragma once
-
-#include <stdint.h>
-
-#include <vector>
-#include <map>
-#include <mutex>
-#include <queue>
-
-#include "Memory.h"
-#include "VirtualMachine.h"
-#include "MemoryRegion.h"
-#include "Timer.h"
-
-class Hardware;
-
-class VirtualMachine {
-public:
-	typedef union reg {
-		uint32_t qword;
-		struct word {
-			uint8_t LL;
-			uint8_t LH;
-			uint8_t HL;
-			uint8_t HH;
-		} word;
-		struct dword {
-			uint16_t L;
-			uint16_t H;
-		} dword;
-	} register_t;
-
-	struct registers {
-		register_t A;
-		register_t B;
-		register_t C;
-		register_t D;
-		register_t E;
-		register_t F;
-
-		register_t W;
-		register_t X;
-		register_t Y;
-		register_t Z;
-
-		uint16_t Flags;
-		uint16_t Clocks;
-
-		uint32_t CS, DS, SS;
-
-		uint32_t PC, SP, BP;
-	};
-
-	enum flag {
-		None		= 0b00000000,
-		Zero		= 0b00000001,
-		Underflow	= 0b00000010,
-		Overflow	= 0b00000100,
-		Parity		= 0b00001000,
-	};
-
-	enum registers_enum {
-		A, AH, AL, AHH, AHL, ALH, ALL,
-		B, BH, BL, BHH, BHL, BLH, BLL,
-		C, CH, CL, CHH, CHL, CLH, CLL,
-		D, DH, DL, DHH, DHL, DLH, DLL,
-		E, EH, EL, EHH, EHL, ELH, ELL,
-		F, FH, FL, FHH, FHL, FLH, FLL,
-		W, WH, WL, WHH, WHL, WLH, WLL,
-		X, XH, XL, XHH, XHL, XLH, XLL,
-		Y, YH, YL, YHH, YHL, YLH, YLL,
-		Z, ZH, ZL, ZHH, ZHL, ZLH, ZLL,
-
-		Flags, Clocks,
-		CS, DS, SS,
-		PC, SP, BP
-	};
-
-	enum machine_status {
-		Off			= 0b00000000,
-		On			= 0b00000001,
-		Halted		= 0b00000010,
-		Sleeping	= 0b00000100,
-		Hybernating = 0b00001000,
-		Breakpoint	= 0b00010000,
-		Fault		= 0b00100000,
-		DFault		= 0b01000000,
-		TFault		= 0b10000000,
-	};
-
-	enum addressing_mode {
-		ImmediateImmediate,
-		ImmediateRegister,
-		ImmediateIndirect,
-		ImmediateRindirect,
-		RegisterImmediate,
-		RegisterRegister,
-		RegisterIndirect,
-		RegisterRindirect,
-		IndirectImmediate,
-		IndirectRegister,
-		IndirectIndirect,
-		IndirectRIndirect,
-		RIndirectImmediate,
-		RIndirectRegister,
-		RIndirectIndirect,
-		RIndirectRIndirect,
-		Immediate,
-		Register,
-		Indirect,
-		RIndirect
-	};
-
-	enum instructions {
-		nop,
-		mov,
-		cmp,
-		cmps,
-		jmp, je, jne, jg, jge, jl, jle,
-		call, calle, callne, callg, callge, calll, callle, 
-		intr,
-		ret, iret,
-		cli, sti,
-		inc, dec,
-		add, sub, mul, div, mod,
-		not, and, or, xor, shl, shr,
-		push, pop, pusha, popa,
-		adds, subs, muls, divs, mods,
-		nots, ands, ors, xors, shls, shrs,
-		mmset, mmcpy,
-		inb, inw, inq,
-		outb, outw, outq,
-		ldidt,
-		hlt
-	};
-
-	struct int_desc {
-		uint32_t address;
-	};
-
-	enum size {
-		word	= 0b00,
-		dword	= 0b01,
-		qword	= 0b10
-	};
-
-	VirtualMachine (uint32_t memorySize);
-	~VirtualMachine ();
-
-	inline void RequestPortInb (uint8_t port, std::function<void (uint8_t value)> func) {
-		this->inpb[port] = func;
-	}
-	inline void RequestPortInd (uint8_t port, std::function<void (uint16_t value)> func) {
-		this->inpd[port] = func;
-	}
-	inline void RequestPortInq (uint8_t port, std::function<void (uint32_t value)> func) {
-		this->inpq[port] = func;
-	}
-
-	inline void RequestPortOutb (uint8_t port, std::function<uint8_t ()> func) {
-		this->outpb[port] = func;
-	}
-	inline void RequestPortOutd (uint8_t port, std::function<uint16_t ()> func) {
-		this->outpd[port] = func;
-	}
-	inline void RequestPortOutq (uint8_t port, std::function<uint32_t ()> func) {
-		this->outpq[port] = func;
-	}
-	
-	inline void QueueKeyState (uint8_t state) { this->keyboard.push (state); }
-
-	void pushw (uint8_t);
-	void pushd (uint16_t);
-	void pushq (uint32_t);
-
-	uint8_t popw ();
-	uint16_t popd ();
-	uint32_t popq ();
-
-	void mpusha ();
-	void mpopa ();
-
-	uint32_t read_reg (uint8_t reg);
-	void set_reg (uint8_t reg, uint32_t val);
-	const char *reg_name (uint8_t reg);
-	const char *addressing_name (addressing_mode mode);
-	uint32_t read_val (size sz);
-	uint32_t read_val_n (size sz, uint32_t addr);
-	uint32_t read_reg_ind (size sz, uint8_t reg);
-	void write_val (size sz, uint32_t addr);
-	void write_reg (size sz, uint32_t addr, uint8_t reg);
-	void write_reg_ind (size sz, uint8_t reg, uint8_t reg2);
-	void write_reg_rind_val_ind (size sz, uint8_t reg, uint32_t);
-	void write_reg_rind_val (size sz, uint8_t reg);
-	void set_reg_reg (size sz, uint8_t, uint8_t);
-
-	void minb (uint8_t port, uint8_t value);
-	void mind (uint8_t port, uint16_t value);
-	void minq (uint8_t port, uint32_t value);
-
-	uint8_t moutb (uint8_t port);
-	uint16_t moutd (uint8_t port);
-	uint32_t moutq (uint8_t port);
-
-	void Start (char *path);
-
-	void AddHardware (Hardware *hardware);
-	void AddMemoryRegion (MemoryRegion *region);
-
-	typedef void (VirtualMachine::*instruction) ();
-
-	std::queue<uint8_t> keyboard;
-
-	struct registers *registers;
-	int status;
-	Memory *memory;
-	instruction instructions[256];
-	std::vector<Hardware *> hardware;
-
-	static std::map<uint8_t, std::function<void (uint8_t)>> inpb;
-	static std::map<uint8_t, std::function<void (uint16_t)>> inpd;
-	static std::map<uint8_t, std::function<void (uint32_t)>> inpq;
-
-	static std::map<uint8_t, std::function<uint8_t ()>> outpb;
-	static std::map<uint8_t, std::function<uint16_t ()>> outpd;
-	static std::map<uint8_t, std::function<uint32_t ()>> outpq;
-
-	int_desc *int_descs;
-	bool interrupts_enabled = false;
-
-	bool inter = false;
-	uint8_t int_line = 0;
-
-	Timer *timer;
-	std::mutex lock;
-
-	void interrupt (uint8_t line);
-
-	void unimplemented_instruction ();
-	
-	void NOP ();
-
-	void MOV ();
-
-	void CMP ();
-	void JMP ();
-	void JE ();	
-	void JNE ();
-	void JG ();	
-	void JGE ();
-	void JL ();	
-	void JLE ();
-
-	void CALL ();
-	void CALLE ();
-
-	void RET ();
-	void IRET ();
-
-	inline void CLI () { printf ("cli"); this->interrupts_enabled = false; }
-	inline void STI () { printf ("sti"); this->interrupts_enabled = true; }
-
-	void INC ();
-	void DEC ();
-
-	void ADD ();
-	void SUB ();
-	void MUL ();
-	void DIV ();
-	void MOD ();
-
-	void NOT ();
-	void AND ();
-	void OR ();	
-	void XOR ();
-
-	void SHL ();
-	void SHR ();
-
-	void PUSH ();
-	void POP ();
-	void PUSHA ();
-	void POPA ();
-
-	void INB ();
-	void INW ();
-	void INQ ();
-
-	void OUTB ();
-	void OUTW ();
-	void OUTQ ();
-
-	void LDIDT ();
-
-	void HLT ();
-};
-
+#pragma once
+
+#include <stdint.h>
+
+#include <vector>
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
+
+#include "Memory.h"
+#include "VirtualMachine.h"
+#include "MemoryRegion.h"
+#include "Timer.h"
+#include "Jit.h"
+#include "Delegate.h"
+#include "InterruptController.h"
+#include "RingBuffer.h"
+
+// Per-instruction disassembly is only compiled in when VM_TRACE is defined
+// (Debug builds); release builds run the guest silently.
+#ifdef VM_TRACE
+#define trace(...) printf (__VA_ARGS__)
+#else
+#define trace(...)
+#endif
+
+class Hardware;
+
+class VirtualMachine {
+public:
+	typedef union reg {
+		uint32_t qword;
+		struct word {
+			uint8_t LL;
+			uint8_t LH;
+			uint8_t HL;
+			uint8_t HH;
+		} word;
+		struct dword {
+			uint16_t L;
+			uint16_t H;
+		} dword;
+	} register_t;
+
+	struct registers {
+		register_t A;
+		register_t B;
+		register_t C;
+		register_t D;
+		register_t E;
+		register_t F;
+
+		register_t W;
+		register_t X;
+		register_t Y;
+		register_t Z;
+
+		uint16_t Flags;
+		uint16_t Clocks;
+
+		uint32_t CS, DS, SS;
+
+		uint32_t PC, SP, BP;
+	};
+
+	enum flag {
+		None		= 0b00000000,
+		Zero		= 0b00000001,
+		Underflow	= 0b00000010,
+		Overflow	= 0b00000100,
+		Parity		= 0b00001000,
+	};
+
+	enum registers_enum {
+		A, AH, AL, AHH, AHL, ALH, ALL,
+		B, BH, BL, BHH, BHL, BLH, BLL,
+		C, CH, CL, CHH, CHL, CLH, CLL,
+		D, DH, DL, DHH, DHL, DLH, DLL,
+		E, EH, EL, EHH, EHL, ELH, ELL,
+		F, FH, FL, FHH, FHL, FLH, FLL,
+		W, WH, WL, WHH, WHL, WLH, WLL,
+		X, XH, XL, XHH, XHL, XLH, XLL,
+		Y, YH, YL, YHH, YHL, YLH, YLL,
+		Z, ZH, ZL, ZHH, ZHL, ZLH, ZLL,
+
+		Flags, Clocks,
+		CS, DS, SS,
+		PC, SP, BP
+	};
+
+	enum machine_status {
+		Off			= 0b00000000,
+		On			= 0b00000001,
+		Halted		= 0b00000010,
+		Sleeping	= 0b00000100,
+		Hybernating = 0b00001000,
+		Breakpoint	= 0b00010000,
+		Fault		= 0b00100000,
+		DFault		= 0b01000000,
+		TFault		= 0b10000000,
+	};
+
+	enum addressing_mode {
+		ImmediateImmediate,
+		ImmediateRegister,
+		ImmediateIndirect,
+		ImmediateRindirect,
+		RegisterImmediate,
+		RegisterRegister,
+		RegisterIndirect,
+		RegisterRindirect,
+		IndirectImmediate,
+		IndirectRegister,
+		IndirectIndirect,
+		IndirectRIndirect,
+		RIndirectImmediate,
+		RIndirectRegister,
+		RIndirectIndirect,
+		RIndirectRIndirect,
+		Immediate,
+		Register,
+		Indirect,
+		RIndirect
+	};
+
+	enum instructions {
+		nop,
+		mov,
+		cmp,
+		cmps,
+		jmp, je, jne, jg, jge, jl, jle,
+		call, calle, callne, callg, callge, calll, callle, 
+		intr,
+		ret, iret,
+		cli, sti,
+		inc, dec,
+		add, sub, mul, div, mod,
+		not, and, or, xor, shl, shr,
+		push, pop, pusha, popa,
+		adds, subs, muls, divs, mods,
+		nots, ands, ors, xors, shls, shrs,
+		mmset, mmcpy,
+		inb, inw, inq,
+		outb, outw, outq,
+		ldidt,
+		hlt,
+		insb, outsb
+	};
+
+	struct int_desc {
+		uint32_t address;
+	};
+
+	enum size {
+		word	= 0b00,
+		dword	= 0b01,
+		qword	= 0b10
+	};
+
+	// Hosted leaves scheduling to a Host, which calls RunSlice
+	enum run_mode {
+		FreeRunning,
+		Throttled,
+		Hosted
+	};
+
+	// Instructions executed back to back before interrupts and status are checked
+	static const int batch_size = 4096;
+
+	static const int decode_cache_size = 4096;
+	static const int keyboard_size = 256;
+	static const int max_instruction_length = 16;
+	static const uint32_t invalid_address = 0xFFFFFFFF;
+
+	VirtualMachine (uint32_t memorySize);
+	~VirtualMachine ();
+
+	// Port handlers are bound to a device method, e.g.
+	// VM->RequestPortInb<Screen, &Screen::SetScale> (0x00, screen);
+	typedef Delegate<void (uint8_t)> port_inb;
+	typedef Delegate<void (uint16_t)> port_ind;
+	typedef Delegate<void (uint32_t)> port_inq;
+	typedef Delegate<uint8_t ()> port_outb;
+	typedef Delegate<uint16_t ()> port_outd;
+	typedef Delegate<uint32_t ()> port_outq;
+
+	// String variants move count bytes in one call; ports without one
+	// fall back to their byte handler once per byte
+	typedef Delegate<void (const uint8_t *data, uint32_t count)> port_insb;
+	typedef Delegate<void (uint8_t *data, uint32_t count)> port_outsb;
+
+	template <class T, void (T::*Method) (uint8_t)>
+	inline void RequestPortInb (uint8_t port, T *device) {
+		this->inpb[port] = port_inb::Bind<T, Method> (device);
+	}
+	template <class T, void (T::*Method) (uint16_t)>
+	inline void RequestPortInd (uint8_t port, T *device) {
+		this->inpd[port] = port_ind::Bind<T, Method> (device);
+	}
+	template <class T, void (T::*Method) (uint32_t)>
+	inline void RequestPortInq (uint8_t port, T *device) {
+		this->inpq[port] = port_inq::Bind<T, Method> (device);
+	}
+	template <class T, void (T::*Method) (const uint8_t *, uint32_t)>
+	inline void RequestPortInsb (uint8_t port, T *device) {
+		this->inpsb[port] = port_insb::Bind<T, Method> (device);
+	}
+
+	template <class T, uint8_t (T::*Method) ()>
+	inline void RequestPortOutb (uint8_t port, T *device) {
+		this->outpb[port] = port_outb::Bind<T, Method> (device);
+	}
+	template <class T, uint16_t (T::*Method) ()>
+	inline void RequestPortOutd (uint8_t port, T *device) {
+		this->outpd[port] = port_outd::Bind<T, Method> (device);
+	}
+	template <class T, uint32_t (T::*Method) ()>
+	inline void RequestPortOutq (uint8_t port, T *device) {
+		this->outpq[port] = port_outq::Bind<T, Method> (device);
+	}
+	template <class T, void (T::*Method) (uint8_t *, uint32_t)>
+	inline void RequestPortOutsb (uint8_t port, T *device) {
+		this->outpsb[port] = port_outsb::Bind<T, Method> (device);
+	}
+	
+	// Called from the window thread; the state/scancode pair is queued or dropped as a unit
+	inline void QueueKeyState (uint8_t state, uint8_t scancode) {
+		const uint8_t event[2] = { state, scancode };
+		this->keyboard.Push (event, 2);
+	}
+
+	void pushw (uint8_t);
+	void pushd (uint16_t);
+	void pushq (uint32_t);
+
+	uint8_t popw ();
+	uint16_t popd ();
+	uint32_t popq ();
+
+	void mpusha ();
+	void mpopa ();
+
+	uint32_t read_reg (uint8_t reg);
+	void set_reg (uint8_t reg, uint32_t val);
+	const char *reg_name (uint8_t reg);
+	const char *addressing_name (addressing_mode mode);
+	uint32_t read_val (size sz);
+	uint32_t read_val_n (size sz, uint32_t addr);
+	uint32_t read_reg_ind (size sz, uint8_t reg);
+	void write_val (size sz, uint32_t addr);
+	void write_reg (size sz, uint32_t addr, uint8_t reg);
+	void write_reg_ind (size sz, uint8_t reg, uint8_t reg2);
+	void write_reg_rind_val_ind (size sz, uint8_t reg, uint32_t);
+	void write_reg_rind_val (size sz, uint8_t reg);
+	void set_reg_reg (size sz, uint8_t, uint8_t);
+
+	void minb (uint8_t port, uint8_t value);
+	void mind (uint8_t port, uint16_t value);
+	void minq (uint8_t port, uint32_t value);
+
+	uint8_t moutb (uint8_t port);
+	uint16_t moutd (uint8_t port);
+	uint32_t moutq (uint8_t port);
+
+	void minsb (uint8_t port, uint32_t addr, uint32_t count);
+	void moutsb (uint8_t port, uint32_t addr, uint32_t count);
+
+	void Start (char *path, run_mode mode = FreeRunning);
+
+	int Step ();
+	void Service ();
+	void Run ();
+	void PowerOff ();
+	// Powers the machine off from another thread and returns once it has
+	// stopped running and its hardware is stopped. A hosted machine is
+	// powered off by its Host instead; Host::Wait waits for that.
+	void Shutdown ();
+
+	// Park blocks the run thread while the machine is halted; Wake is called
+	// after an interrupt is raised or status is changed from another thread
+	void Park ();
+	void Wake ();
+
+	// Runs until budget instructions have executed or the machine halts,
+	// then services interrupts; returns the number executed
+	int RunSlice (int budget);
+	static void RunBatch (void *context);
+
+	void AddHardware (Hardware *hardware);
+	void AddMemoryRegion (MemoryRegion *region);
+
+	typedef void (VirtualMachine::*instruction) ();
+
+	// Handlers specialized at compile time for every (addressing_mode, size) pair
+	typedef instruction handler_table[RIndirect + 1][qword + 1];
+
+	struct opcode_info {
+		const handler_table *handlers;
+		bool sized;
+	};
+
+	// An instruction pre-fetched from RAM, keyed by its address. Handlers
+	// read their operands out of bytes instead of walking Memory; header is
+	// the opcode/addressing_mode/size prefix the specialized handler skips.
+	struct decoded {
+		uint32_t address;
+		instruction handler;
+		uint8_t header;
+		uint8_t window;
+		uint8_t bytes[max_instruction_length];
+
+		Jit::block *block;
+		uint16_t hits;
+	};
+
+	decoded *Decode (uint32_t address);
+	void Resolve (decoded *entry, uint8_t opcode, uint8_t mode, uint8_t sz);
+	void InvalidateCode (uint32_t page);
+
+	inline uint8_t fetchw () {
+		uint32_t addr = this->registers->PC++;
+		uint32_t offset = addr - this->fetch_base;
+		if (offset < this->fetch->window)
+			return this->fetch->bytes[offset];
+		return this->memory->readw (addr);
+	}
+	inline uint16_t fetchd () {
+		uint16_t low = this->fetchw ();
+		return low | (this->fetchw () << 8);
+	}
+	inline uint32_t fetchq () {
+		uint32_t low = this->fetchd ();
+		return low | (this->fetchd () << 16);
+	}
+
+	RingBuffer<uint8_t, keyboard_size> keyboard;
+
+	struct registers *registers;
+	int status = Off;
+	Memory *memory;
+	instruction instructions[256];
+	opcode_info opcodes[256];
+
+	decoded decode_cache[decode_cache_size];
+	decoded uncached;
+	decoded *fetch;
+	uint32_t fetch_base;
+	std::vector<Hardware *> hardware;
+
+	port_inb inpb[256];
+	port_ind inpd[256];
+	port_inq inpq[256];
+	port_insb inpsb[256];
+
+	port_outb outpb[256];
+	port_outd outpd[256];
+	port_outq outpq[256];
+	port_outsb outpsb[256];
+
+	// Guest address of the interrupt descriptor table loaded by ldidt
+	uint32_t idt = 0;
+	bool interrupts_enabled = false;
+
+	InterruptController *pic;
+
+	Jit *jit = nullptr;
+	Timer *timer = nullptr;
+	std::thread *thread = nullptr;
+
+	int budget = 0;
+	int executed = 0;
+
+	std::mutex wake_lock;
+	std::condition_variable woken;
+	// Set while nothing is running this machine, so Raise knows to Wake it
+	std::atomic<bool> parked;
+	// Set by a Host so a wake reaches the worker pool
+	std::function<void ()> Wakeup = nullptr;
+
+	void interrupt (uint8_t line);
+	bool InterruptReady () const;
+
+	void unimplemented_instruction ();
+	void invalid_encoding ();
+	
+	void NOP ();
+
+	template <int M, int S> void MOV ();
+
+	template <int M, int S> void CMP ();
+	template <int M, int S> void JMP ();
+	template <int M, int S> void JE ();	
+	template <int M, int S> void JNE ();
+	void JG ();	
+	void JGE ();
+	template <int M, int S> void JL ();	
+	void JLE ();
+
+	template <int M, int S> void CALL ();
+	template <int M, int S> void CALLE ();
+
+	void RET ();
+	void IRET ();
+
+	inline void CLI () { trace ("cli"); this->interrupts_enabled = false; }
+	inline void STI () { trace ("sti"); this->interrupts_enabled = true; }
+
+	template <int M, int S> void INC ();
+	void DEC ();
+
+	template <int M, int S> void ADD ();
+	void SUB ();
+	template <int M, int S> void MUL ();
+	void DIV ();
+	void MOD ();
+
+	void NOT ();
+	void AND ();
+	template <int M, int S> void OR ();	
+	template <int M, int S> void XOR ();
+
+	template <int M, int S> void SHL ();
+	void SHR ();
+
+	void PUSH ();
+	void POP ();
+	void PUSHA ();
+	void POPA ();
+
+	template <int M, int S> void INB ();
+	void INW ();
+	template <int M, int S> void INQ ();
+
+	template <int M, int S> void OUTB ();
+	void OUTW ();
+	template <int M, int S> void OUTQ ();
+
+	template <int M, int S> void LDIDT ();
+
+	template <int M, int S> void INSB ();
+	template <int M, int S> void OUTSB ();
+
+	void HLT ();
+};
+